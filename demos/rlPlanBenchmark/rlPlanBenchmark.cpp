@@ -0,0 +1,369 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/plan/Prm.h>
+#include <rl/plan/Rrt.h>
+#include <rl/plan/Statistics.h>
+
+#include "Scenario.h"
+
+/**
+ * Result of a single planner run.
+ */
+struct Run
+{
+	std::size_t cacheHits;
+	
+	std::size_t cacheMisses;
+	
+	std::vector<std::size_t> counts;
+	
+	rl::math::Real duration;
+	
+	std::vector<rl::math::Real> durations;
+	
+	std::size_t edges;
+	
+	std::size_t freeQueries;
+	
+	rl::math::Real length;
+	
+	std::mt19937::result_type seed;
+	
+	bool solved;
+	
+	std::string statistics;
+	
+	std::size_t totalQueries;
+	
+	std::size_t vertices;
+};
+
+rl::math::Real
+percentile(const std::vector<rl::math::Real>& sorted, const rl::math::Real& p)
+{
+	if (sorted.empty())
+	{
+		return 0;
+	}
+	
+	std::size_t rank = static_cast<std::size_t>(std::ceil(p * sorted.size()));
+	return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+
+int
+main(int argc, char** argv)
+{
+	std::string engine;
+	std::vector<std::string> engines;
+	
+#ifdef RL_SG_BULLET
+	engines.push_back("bullet");
+	engine = "bullet";
+#endif // RL_SG_BULLET
+#ifdef RL_SG_SOLID
+	engines.push_back("solid");
+	engine = "solid";
+#endif // RL_SG_SOLID
+#ifdef RL_SG_ODE
+	engines.push_back("ode");
+	engine = "ode";
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	engines.push_back("pqp");
+	engine = "pqp";
+#endif // RL_SG_PQP
+#ifdef RL_SG_FCL
+	engines.push_back("fcl");
+	engine = "fcl";
+#endif // RL_SG_FCL
+	
+	std::sort(engines.begin(), engines.end());
+	
+	std::size_t cacheSize = 0;
+	std::string filename;
+	std::string format = "csv";
+	std::size_t runs = 10;
+	std::mt19937::result_type seed = 0;
+	
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+		
+		if (0 == argument.compare(0, 8, "--cache="))
+		{
+			cacheSize = boost::lexical_cast<std::size_t>(argument.substr(8));
+		}
+		else if (0 == argument.compare(0, 9, "--engine="))
+		{
+			engine = argument.substr(9);
+		}
+		else if (0 == argument.compare(0, 9, "--format="))
+		{
+			format = argument.substr(9);
+		}
+		else if (0 == argument.compare(0, 7, "--runs="))
+		{
+			runs = boost::lexical_cast<std::size_t>(argument.substr(7));
+		}
+		else if (0 == argument.compare(0, 7, "--seed="))
+		{
+			seed = boost::lexical_cast<std::mt19937::result_type>(argument.substr(7));
+		}
+		else if (0 != argument.compare(0, 2, "--"))
+		{
+			filename = argument;
+		}
+		else
+		{
+			filename.clear();
+			break;
+		}
+	}
+	
+	if (filename.empty() || ("csv" != format && "json" != format))
+	{
+		std::cout << "Usage: rlPlanBenchmark PLANFILE [--cache=SIZE] [--engine=";
+		
+		for (std::size_t i = 0; i < engines.size(); ++i)
+		{
+			std::cout << (i > 0 ? "|" : "") << engines[i];
+		}
+		
+		std::cout << "] [--format=csv|json] [--runs=RUNS] [--seed=SEED]" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		Scenario scenario;
+		scenario.load(Scenario::parse(filename), engine);
+		
+		rl::plan::Statistics statistics;
+		scenario.planner->statistics = &statistics;
+		
+		for (std::size_t i = 0; i < scenario.instances.size(); ++i)
+		{
+			scenario.instances[i].model->setCacheSize(cacheSize);
+			scenario.instances[i].model->statistics = &statistics;
+		}
+		
+		if (!scenario.planner->verify())
+		{
+			throw std::runtime_error("invalid start or goal configuration");
+		}
+		
+		std::vector<Run> results(runs);
+		
+		for (std::size_t i = 0; i < runs; ++i)
+		{
+			Run& run = results[i];
+			run.seed = seed + static_cast<std::mt19937::result_type>(i);
+			
+			scenario.planner->reset();
+			
+			for (std::size_t j = 0; j < scenario.instances.size(); ++j)
+			{
+				scenario.instances[j].model->reset();
+			}
+			
+			statistics.clear();
+			scenario.seed(run.seed);
+			
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			run.solved = scenario.planner->solve();
+			std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+			
+			run.cacheHits = 0;
+			run.cacheMisses = 0;
+			run.duration = std::chrono::duration_cast<std::chrono::duration<rl::math::Real>>(stop - start).count();
+			run.freeQueries = 0;
+			run.totalQueries = 0;
+			
+			for (std::size_t j = 0; j < scenario.instances.size(); ++j)
+			{
+				run.cacheHits += scenario.instances[j].model->getCacheHits();
+				run.cacheMisses += scenario.instances[j].model->getCacheMisses();
+				run.freeQueries += scenario.instances[j].model->getFreeQueries();
+				run.totalQueries += scenario.instances[j].model->getTotalQueries();
+			}
+			
+			if (rl::plan::Prm* prm = dynamic_cast<rl::plan::Prm*>(scenario.planner.get()))
+			{
+				run.edges = prm->getNumEdges();
+				run.vertices = prm->getNumVertices();
+			}
+			else if (rl::plan::Rrt* rrt = dynamic_cast<rl::plan::Rrt*>(scenario.planner.get()))
+			{
+				run.edges = rrt->getNumEdges();
+				run.vertices = rrt->getNumVertices();
+			}
+			else
+			{
+				run.edges = 0;
+				run.vertices = 0;
+			}
+			
+			for (std::size_t j = 0; j < rl::plan::Statistics::PHASES; ++j)
+			{
+				rl::plan::Statistics::Phase phase = static_cast<rl::plan::Statistics::Phase>(j);
+				run.counts.push_back(statistics.getCount(phase));
+				run.durations.push_back(std::chrono::duration_cast<std::chrono::duration<rl::math::Real>>(statistics.getDuration(phase)).count());
+			}
+			
+			std::ostringstream stream;
+			statistics.write(stream);
+			run.statistics = stream.str();
+			
+			run.length = 0;
+			
+			if (run.solved)
+			{
+				rl::plan::VectorList path = scenario.planner->getPath();
+				
+				if (nullptr != scenario.optimizer)
+				{
+					scenario.optimizer->process(path);
+				}
+				
+				rl::plan::VectorList::iterator j = path.begin();
+				rl::plan::VectorList::iterator k = ++path.begin();
+				
+				for (; j != path.end() && k != path.end(); ++j, ++k)
+				{
+					run.length += scenario.model->distance(*j, *k);
+				}
+			}
+		}
+		
+		if ("csv" == format)
+		{
+			std::cout << "Run,Seed,Solved,Planner,Vertices,Edges,Total CD,Free CD,Cache Hits,Cache Misses,Duration (s),Path Length";
+			
+			for (std::size_t i = 0; i < rl::plan::Statistics::PHASES; ++i)
+			{
+				std::string name = rl::plan::Statistics::getName(static_cast<rl::plan::Statistics::Phase>(i));
+				std::cout << "," << name << " Count," << name << " Duration (s)";
+			}
+			
+			std::cout << std::endl;
+			
+			for (std::size_t i = 0; i < runs; ++i)
+			{
+				std::cout << i << "," << results[i].seed << "," << (results[i].solved ? "true" : "false") << ",";
+				std::cout << scenario.planner->getName() << ",";
+				std::cout << results[i].vertices << "," << results[i].edges << ",";
+				std::cout << results[i].totalQueries << "," << results[i].freeQueries << ",";
+				std::cout << results[i].cacheHits << "," << results[i].cacheMisses << ",";
+				std::cout << results[i].duration << "," << results[i].length;
+				
+				for (std::size_t j = 0; j < rl::plan::Statistics::PHASES; ++j)
+				{
+					std::cout << "," << results[i].counts[j] << "," << results[i].durations[j];
+				}
+				
+				std::cout << std::endl;
+			}
+		}
+		else
+		{
+			std::vector<rl::math::Real> durations;
+			rl::math::Real length = 0;
+			rl::math::Real totalQueries = 0;
+			rl::math::Real vertices = 0;
+			
+			for (std::size_t i = 0; i < runs; ++i)
+			{
+				if (results[i].solved)
+				{
+					durations.push_back(results[i].duration);
+					length += results[i].length;
+				}
+				
+				totalQueries += results[i].totalQueries;
+				vertices += results[i].vertices;
+			}
+			
+			std::sort(durations.begin(), durations.end());
+			
+			std::cout << "{" << std::endl;
+			std::cout << "\t\"planner\": \"" << scenario.planner->getName() << "\"," << std::endl;
+			std::cout << "\t\"engine\": \"" << engine << "\"," << std::endl;
+			std::cout << "\t\"runs\": [" << std::endl;
+			
+			for (std::size_t i = 0; i < runs; ++i)
+			{
+				std::cout << "\t\t{";
+				std::cout << "\"seed\": " << results[i].seed << ", ";
+				std::cout << "\"solved\": " << (results[i].solved ? "true" : "false") << ", ";
+				std::cout << "\"duration\": " << results[i].duration << ", ";
+				std::cout << "\"vertices\": " << results[i].vertices << ", ";
+				std::cout << "\"edges\": " << results[i].edges << ", ";
+				std::cout << "\"totalQueries\": " << results[i].totalQueries << ", ";
+				std::cout << "\"freeQueries\": " << results[i].freeQueries << ", ";
+				std::cout << "\"cacheHits\": " << results[i].cacheHits << ", ";
+				std::cout << "\"cacheMisses\": " << results[i].cacheMisses << ", ";
+				std::cout << "\"length\": " << results[i].length << ", ";
+				std::cout << "\"statistics\": " << results[i].statistics;
+				std::cout << "}" << (i + 1 < runs ? "," : "") << std::endl;
+			}
+			
+			std::cout << "\t]," << std::endl;
+			std::cout << "\t\"summary\": {";
+			std::cout << "\"successRate\": " << (runs > 0 ? static_cast<rl::math::Real>(durations.size()) / runs : 0) << ", ";
+			std::cout << "\"duration\": {";
+			std::cout << "\"min\": " << percentile(durations, 0) << ", ";
+			std::cout << "\"p50\": " << percentile(durations, static_cast<rl::math::Real>(0.5)) << ", ";
+			std::cout << "\"p90\": " << percentile(durations, static_cast<rl::math::Real>(0.9)) << ", ";
+			std::cout << "\"p99\": " << percentile(durations, static_cast<rl::math::Real>(0.99)) << ", ";
+			std::cout << "\"max\": " << percentile(durations, 1);
+			std::cout << "}, ";
+			std::cout << "\"totalQueries\": " << (runs > 0 ? totalQueries / runs : 0) << ", ";
+			std::cout << "\"vertices\": " << (runs > 0 ? vertices / runs : 0) << ", ";
+			std::cout << "\"length\": " << (durations.size() > 0 ? length / durations.size() : 0);
+			std::cout << "}" << std::endl;
+			std::cout << "}" << std::endl;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
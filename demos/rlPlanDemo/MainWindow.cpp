@@ -47,56 +47,15 @@
 #include <rl/math/Rotation.h>
 #include <rl/math/Unit.h>
 #include <rl/mdl/XmlFactory.h>
-#include <rl/plan/AddRrtConCon.h>
-#include <rl/plan/AdvancedOptimizer.h>
-#include <rl/plan/BridgeSampler.h>
-#include <rl/plan/DistanceModel.h>
-#include <rl/plan/Eet.h>
-#include <rl/plan/GaussianSampler.h>
-#include <rl/plan/GnatNearestNeighbors.h>
-#include <rl/plan/KdtreeBoundingBoxNearestNeighbors.h>
-#include <rl/plan/KdtreeNearestNeighbors.h>
-#include <rl/plan/LinearNearestNeighbors.h>
-#include <rl/plan/Prm.h>
-#include <rl/plan/PrmUtilityGuided.h>
-#include <rl/plan/RecursiveVerifier.h>
-#include <rl/plan/Rrt.h>
-#include <rl/plan/RrtCon.h>
-#include <rl/plan/RrtConCon.h>
-#include <rl/plan/RrtDual.h>
-#include <rl/plan/RrtExtCon.h>
-#include <rl/plan/RrtExtExt.h>
-#include <rl/plan/RrtGoalBias.h>
-#include <rl/plan/SequentialVerifier.h>
-#include <rl/plan/SimpleModel.h>
-#include <rl/plan/SimpleOptimizer.h>
 #include <rl/plan/UniformSampler.h>
 #include <rl/plan/WorkspaceSphereExplorer.h>
 #include <rl/sg/Body.h>
 #include <rl/sg/XmlFactory.h>
 #include <rl/xml/Attribute.h>
 #include <rl/xml/Document.h>
-#include <rl/xml/DomParser.h>
 #include <rl/xml/Node.h>
 #include <rl/xml/Object.h>
 #include <rl/xml/Path.h>
-#include <rl/xml/Stylesheet.h>
-
-#ifdef RL_SG_BULLET
-#include <rl/sg/bullet/Scene.h>
-#endif // RL_SG_BULLET
-#ifdef RL_SG_FCL
-#include <rl/sg/fcl/Scene.h>
-#endif // RL_SG_FCL
-#ifdef RL_SG_ODE
-#include <rl/sg/ode/Scene.h>
-#endif // RL_SG_ODE
-#ifdef RL_SG_PQP
-#include <rl/sg/pqp/Scene.h>
-#endif // RL_SG_PQP
-#ifdef RL_SG_SOLID
-#include <rl/sg/solid/Scene.h>
-#endif // RL_SG_SOLID
 
 #include "ConfigurationDelegate.h"
 #include "ConfigurationModel.h"
@@ -105,6 +64,7 @@
 #include "GraphicsView.h"
 #include "MainWindow.h"
 #include "PlannerModel.h"
+#include "Scenario.h"
 #include "SoGradientBackground.h"
 #include "Thread.h"
 #include "Viewer.h"
@@ -118,6 +78,7 @@ MainWindow::MainWindow(QWidget* parent, Qt::WindowFlags f) :
 	explorers(),
 	explorerStarts(),
 	goal(),
+	instances(),
 	kin(),
 	kin2(),
 	mdl(),
@@ -381,6 +342,7 @@ MainWindow::clear()
 	this->explorers.clear();
 	this->explorerStarts.clear();
 	this->goal.reset();
+	this->instances.clear();
 	this->kin.reset();
 	this->kin2.reset();
 	this->mdl.reset();
@@ -884,144 +846,38 @@ MainWindow::load(const QString& filename)
 	
 	this->clear();
 	
-	rl::xml::DomParser parser;
-	
-	rl::xml::Document document = parser.readFile(filename.toStdString(), "", XML_PARSE_NOENT | XML_PARSE_XINCLUDE);
-	document.substitute(XML_PARSE_NOENT | XML_PARSE_XINCLUDE);
-	
-	if ("stylesheet" == document.getRootElement().getName() || "transform" == document.getRootElement().getName())
-	{
-		if ("1.0" == document.getRootElement().getProperty("version"))
-		{
-			if (document.getRootElement().hasNamespace() && "http://www.w3.org/1999/XSL/Transform" == document.getRootElement().getNamespace().getHref())
-			{
-				rl::xml::Stylesheet stylesheet(document);
-				document = stylesheet.apply();
-			}
-		}
-	}
+	rl::xml::Document document = Scenario::parse(filename.toStdString());
 	
 	this->filename = filename;
 	this->setWindowTitle(filename + " - " + this->engine.toUpper() + " - rlPlanDemo");
 	
 	rl::xml::Path path(document);
 	
-#ifdef RL_SG_BULLET
-	if ("bullet" == this->engine)
-	{
-		this->scene = std::make_shared<rl::sg::bullet::Scene>();
-	}
-#endif // RL_SG_BULLET
-#ifdef RL_SG_FCL
-	if ("fcl" == this->engine)
-	{
-		this->scene = std::make_shared<rl::sg::fcl::Scene>();
-	}
-#endif // RL_SG_FCL
-#ifdef RL_SG_ODE
-	if ("ode" == this->engine)
-	{
-		this->scene = std::make_shared<rl::sg::ode::Scene>();
-	}
-#endif // RL_SG_ODE
-#ifdef RL_SG_PQP
-	if ("pqp" == this->engine)
-	{
-		this->scene = std::make_shared<rl::sg::pqp::Scene>();
-	}
-#endif // RL_SG_PQP
-#ifdef RL_SG_SOLID
-	if ("solid" == this->engine)
-	{
-		this->scene = std::make_shared<rl::sg::solid::Scene>();
-	}
-#endif // RL_SG_SOLID
+	Scenario scenario;
+	scenario.load(document, this->engine.toStdString(), this->seed);
+	
+	this->explorerGoals = scenario.explorerGoals;
+	this->explorers = scenario.explorers;
+	this->explorerStarts = scenario.explorerStarts;
+	this->goal = scenario.goal;
+	this->instances = scenario.instances;
+	this->kin = scenario.kin;
+	this->mdl = scenario.mdl;
+	this->model = scenario.model;
+	this->nearestNeighbors = scenario.nearestNeighbors;
+	this->optimizer = scenario.optimizer;
+	this->planner = scenario.planner;
+	this->sampler = scenario.sampler;
+	this->scene = scenario.scene;
+	this->sceneModel = scenario.model->model;
+	this->sigma = scenario.sigma;
+	this->start = scenario.start;
+	this->verifier = scenario.verifier;
+	this->verifier2 = scenario.verifier2;
 	
 	rl::mdl::XmlFactory modelFactory;
 	rl::sg::XmlFactory sceneFactory;
 	
-	rl::xml::NodeSet modelScene = path.eval("(/rl/plan|/rlplan)//model/scene").getValue<rl::xml::NodeSet>();
-	sceneFactory.load(modelScene[0].getUri(modelScene[0].getProperty("href")), this->scene.get());
-	this->sceneModel = this->scene->getModel(
-		path.eval("number((/rl/plan|/rlplan)//model/model)").getValue<std::size_t>()
-	);
-	
-	if ("mdl" == path.eval("string((/rl/plan|/rlplan)//model/kinematics/@type)").getValue<std::string>())
-	{
-		rl::xml::NodeSet mdl = path.eval("(/rl/plan|/rlplan)//model/kinematics").getValue<rl::xml::NodeSet>();
-		this->mdl = std::dynamic_pointer_cast<rl::mdl::Kinematic>(modelFactory.create(
-			mdl[0].getUri(mdl[0].getProperty("href"))
-		));
-		
-		if (path.eval("count((/rl/plan|/rlplan)//model/kinematics/world) > 0").getValue<bool>())
-		{
-			this->mdl->world() = rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/z)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitZ()
-			) * rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/y)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitY()
-			) * rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/x)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitX()
-			);
-			
-			this->mdl->world().translation().x() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/x)").getValue<rl::math::Real>(0);
-			this->mdl->world().translation().y() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/y)").getValue<rl::math::Real>(0);
-			this->mdl->world().translation().z() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/z)").getValue<rl::math::Real>(0);
-		}
-	}
-	else
-	{
-		rl::xml::NodeSet kin = path.eval("(/rl/plan|/rlplan)//model/kinematics").getValue<rl::xml::NodeSet>();
-		this->kin = rl::kin::Kinematics::create(
-			kin[0].getUri(kin[0].getProperty("href"))
-		);
-		
-		if (path.eval("count((/rl/plan|/rlplan)//model/kinematics/world) > 0").getValue<bool>())
-		{
-			this->kin->world() = rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/z)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitZ()
-			) * rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/y)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitY()
-			) * rl::math::AngleAxis(
-				path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/rotation/x)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
-				rl::math::Vector3::UnitX()
-			);
-			
-			this->kin->world().translation().x() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/x)").getValue<rl::math::Real>(0);
-			this->kin->world().translation().y() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/y)").getValue<rl::math::Real>(0);
-			this->kin->world().translation().z() = path.eval("number((/rl/plan|/rlplan)//model/kinematics/world/translation/z)").getValue<rl::math::Real>(0);
-		}
-	}
-	
-	if (rl::sg::DistanceScene* scene = dynamic_cast<rl::sg::DistanceScene*>(this->scene.get()))
-	{
-		this->model = std::make_shared<rl::plan::DistanceModel>();
-	}
-	else if (rl::sg::SimpleScene* scene = dynamic_cast<rl::sg::SimpleScene*>(this->scene.get()))
-	{
-		this->model = std::make_shared<rl::plan::SimpleModel>();
-	}
-	else
-	{
-		throw std::runtime_error("selected engine does not support collision queries");
-	}
-	
-	if (nullptr != this->kin)
-	{
-		this->model->kin = this->kin.get();
-	}
-	else if (nullptr != this->mdl)
-	{
-		this->model->mdl = this->mdl.get();
-	}
-	
-	this->model->model = this->sceneModel;
-	this->model->scene = this->scene.get();
-	
 	this->q = std::make_shared<rl::math::Vector>(this->model->getDofPosition());
 	
 	if (nullptr != this->scene2)
@@ -1102,755 +958,11 @@ MainWindow::load(const QString& filename)
 	this->model2->model = this->sceneModel2;
 	this->model2->scene = this->scene2.get();
 	
-	rl::xml::NodeSet start = path.eval("(/rl/plan|/rlplan)//start/q").getValue<rl::xml::NodeSet>();
-	this->start = std::make_shared<rl::math::Vector>(start.size());
-	
-	for (int i = 0; i < start.size(); ++i)
-	{
-		(*this->start)(i) = std::atof(start[i].getContent().c_str());
-		
-		if ("deg" == start[i].getProperty("unit"))
-		{
-			(*this->start)(i) *= rl::math::DEG2RAD;
-		}
-	}
-	
 	*this->q = *this->start;
 	
-	rl::xml::NodeSet goal = path.eval("(/rl/plan|/rlplan)//goal/q").getValue<rl::xml::NodeSet>();
-	this->goal = std::make_shared<rl::math::Vector>(goal.size());
-	
-	for (int i = 0; i < goal.size(); ++i)
-	{
-		(*this->goal)(i) = std::atof(goal[i].getContent().c_str());
-		
-		if ("deg" == goal[i].getProperty("unit"))
-		{
-			(*this->goal)(i) *= rl::math::DEG2RAD;
-		}
-	}
-	
-	if (path.eval("count((/rl/plan|/rlplan)//sigma) > 0").getValue<bool>())
-	{
-		rl::xml::NodeSet sigma = path.eval("(/rl/plan|/rlplan)//sigma/q").getValue<rl::xml::NodeSet>();
-		this->sigma = std::make_shared<rl::math::Vector>(sigma.size());
-		
-		for (int i = 0; i < sigma.size(); ++i)
-		{
-			(*this->sigma)(i) = std::atof(sigma[i].getContent().c_str());
-			
-			if ("deg" == sigma[i].getProperty("unit"))
-			{
-				(*this->sigma)(i) *= rl::math::DEG2RAD;
-			}
-		}
-	}
-	
-	if (path.eval("count((/rl/plan|/rlplan)//uniformSampler) > 0").getValue<bool>())
-	{
-		this->sampler = std::make_shared<rl::plan::UniformSampler>();
-		rl::plan::UniformSampler* uniformSampler = static_cast<rl::plan::UniformSampler*>(this->sampler.get());
-		
-		if (path.eval("count((/rl/plan|/rlplan)//uniformSampler/seed) > 0").getValue<bool>())
-		{
-			uniformSampler->seed(
-				path.eval("number((/rl/plan|/rlplan)//uniformSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
-			);
-		}
-		else if (this->seed)
-		{
-			uniformSampler->seed(*this->seed);
-		}
-	}
-	else if (path.eval("count((/rl/plan|/rlplan)//gaussianSampler) > 0").getValue<bool>())
-	{
-		this->sampler = std::make_shared<rl::plan::GaussianSampler>();
-		rl::plan::GaussianSampler* gaussianSampler = static_cast<rl::plan::GaussianSampler*>(this->sampler.get());
-		
-		if (path.eval("count((/rl/plan|/rlplan)//gaussianSampler/seed) > 0").getValue<bool>())
-		{
-			gaussianSampler->seed(
-				path.eval("number((/rl/plan|/rlplan)//gaussianSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
-			);
-		}
-		else if (this->seed)
-		{
-			gaussianSampler->seed(*this->seed);
-		}
-		
-		gaussianSampler->sigma = this->sigma.get();
-	}
-	else if (path.eval("count((/rl/plan|/rlplan)//bridgeSampler) > 0").getValue<bool>())
-	{
-		this->sampler = std::make_shared<rl::plan::BridgeSampler>();
-		rl::plan::BridgeSampler* bridgeSampler = static_cast<rl::plan::BridgeSampler*>(this->sampler.get());
-		bridgeSampler->ratio = path.eval("number((/rl/plan|/rlplan)//bridgeSampler/ratio)").getValue<rl::math::Real>(static_cast<rl::math::Real>(5) / static_cast<rl::math::Real>(6));
-		
-		if (path.eval("count((/rl/plan|/rlplan)//bridgeSampler/seed) > 0").getValue<bool>())
-		{
-			bridgeSampler->seed(
-				path.eval("number((/rl/plan|/rlplan)//bridgeSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
-			);
-		}
-		else if (this->seed)
-		{
-			bridgeSampler->seed(*this->seed);
-		}
-		
-		bridgeSampler->sigma = this->sigma.get();
-	}
-	
-	if (nullptr != this->sampler)
-	{
-		this->sampler->model = this->model.get();
-	}
-	
 	this->sampler2 = std::make_shared<rl::plan::UniformSampler>();
 	this->sampler2->model = this->model.get();
 	
-	if (path.eval("count((/rl/plan|/rlplan)//recursiveVerifier) > 0").getValue<bool>())
-	{
-		this->verifier = std::make_shared<rl::plan::RecursiveVerifier>();
-		this->verifier->delta = path.eval("number((/rl/plan|/rlplan)//recursiveVerifier/delta)").getValue<rl::math::Real>(1);
-		
-		if ("deg" == path.eval("string((/rl/plan|/rlplan)//recursiveVerifier/delta/@unit)").getValue<std::string>())
-		{
-			this->verifier->delta *= rl::math::DEG2RAD;
-		}
-	}
-	else if (path.eval("count((/rl/plan|/rlplan)//sequentialVerifier) > 0").getValue<bool>())
-	{
-		this->verifier = std::make_shared<rl::plan::SequentialVerifier>();
-		this->verifier->delta = path.eval("number((/rl/plan|/rlplan)//sequentialVerifier/delta)").getValue<rl::math::Real>(1);
-		
-		if ("deg" == path.eval("string((/rl/plan|/rlplan)//sequentialVerifier/delta/@unit)").getValue<std::string>())
-		{
-			this->verifier->delta *= rl::math::DEG2RAD;
-		}
-	}
-	
-	if (nullptr != this->verifier)
-	{
-		this->verifier->model = this->model.get();
-	}
-	
-	if (path.eval("count((/rl/plan|/rlplan)//simpleOptimizer/recursiveVerifier) > 0").getValue<bool>())
-	{
-		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
-		this->verifier2->delta = path.eval("number((/rl/plan|/rlplan)//simpleOptimizer/recursiveVerifier/delta)").getValue<rl::math::Real>(1);
-		
-		if ("deg" == path.eval("string((/rl/plan|/rlplan)//simpleOptimizer/recursiveVerifier/delta/@unit)").getValue<std::string>())
-		{
-			this->verifier2->delta *= rl::math::DEG2RAD;
-		}
-	}
-	else if (path.eval("count((/rl/plan|/rlplan)//advancedOptimizer/recursiveVerifier) > 0").getValue<bool>())
-	{
-		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
-		this->verifier2->delta = path.eval("number((/rl/plan|/rlplan)//advancedOptimizer/recursiveVerifier/delta)").getValue<rl::math::Real>(1);
-		
-		if ("deg" == path.eval("string((/rl/plan|/rlplan)//advancedOptimizer/recursiveVerifier/delta/@unit)").getValue<std::string>())
-		{
-			this->verifier2->delta *= rl::math::DEG2RAD;
-		}
-	}
-	
-	if (nullptr != this->verifier2)
-	{
-		this->verifier2->model = this->model.get();
-	}
-	
-	this->optimizer.reset();
-	
-	if (path.eval("count((/rl/plan|/rlplan)//simpleOptimizer) > 0").getValue<bool>())
-	{
-		this->optimizer = std::make_shared<rl::plan::SimpleOptimizer>();
-	}
-	else if (path.eval("count((/rl/plan|/rlplan)//advancedOptimizer) > 0").getValue<bool>())
-	{
-		this->optimizer = std::make_shared<rl::plan::AdvancedOptimizer>();
-		rl::plan::AdvancedOptimizer* advancedOptimizer = static_cast<rl::plan::AdvancedOptimizer*>(this->optimizer.get());
-		advancedOptimizer->length = path.eval("number((/rl/plan|/rlplan)//advancedOptimizer/length)").getValue<rl::math::Real>(1);
-		
-		if ("deg" == path.eval("string((/rl/plan|/rlplan)//advancedOptimizer/length/@unit)").getValue<std::string>())
-		{
-			advancedOptimizer->length *= rl::math::DEG2RAD;
-		}
-		
-		advancedOptimizer->ratio = path.eval("number((/rl/plan|/rlplan)//advancedOptimizer/ratio)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
-	}
-	
-	if (nullptr != this->optimizer)
-	{
-		this->optimizer->model = this->model.get();
-		this->optimizer->verifier = this->verifier2.get();
-	}
-	
-	rl::xml::NodeSet planners = path.eval("(/rl/plan|/rlplan)//addRrtConCon|(/rl/plan|/rlplan)//eet|(/rl/plan|/rlplan)//prm|(/rl/plan|/rlplan)//prmUtilityGuided|(/rl/plan|/rlplan)//rrt|(/rl/plan|/rlplan)//rrtCon|(/rl/plan|/rlplan)//rrtConCon|(/rl/plan|/rlplan)//rrtConExt|(/rl/plan|/rlplan)//rrtDual|(/rl/plan|/rlplan)//rrtGoalBias|(/rl/plan|/rlplan)//rrtExtCon|(/rl/plan|/rlplan)//rrtExtExt").getValue<rl::xml::NodeSet>();
-	
-	for (int i = 0; i < std::min(1, planners.size()); ++i)
-	{
-		rl::xml::Path path(document, planners[i]);
-		
-		if ("addRrtConCon" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::AddRrtConCon>();
-			rl::plan::AddRrtConCon* addRrtConCon = static_cast<rl::plan::AddRrtConCon*>(this->planner.get());
-			addRrtConCon->alpha = path.eval("number(alpha)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
-			addRrtConCon->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				addRrtConCon->delta *= rl::math::DEG2RAD;
-			}
-			
-			addRrtConCon->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				addRrtConCon->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			addRrtConCon->lower = path.eval("number(lower)").getValue<rl::math::Real>(2);
-			
-			if ("deg" == path.eval("string(lower/@unit)").getValue<std::string>())
-			{
-				addRrtConCon->lower *= rl::math::DEG2RAD;
-			}
-			
-			addRrtConCon->radius = path.eval("number(radius)").getValue<rl::math::Real>(20);
-			
-			if ("deg" == path.eval("string(radius/@unit)").getValue<std::string>())
-			{
-				addRrtConCon->radius *= rl::math::DEG2RAD;
-			}
-			
-			addRrtConCon->sampler = this->sampler.get();
-		}
-		else if ("eet" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::Eet>();
-			rl::plan::Eet* eet = static_cast<rl::plan::Eet*>(this->planner.get());
-			eet->alpha = path.eval("number(alpha)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.01));
-			eet->alternativeDistanceComputation = path.eval("count(alternativeDistanceComputation) > 0").getValue<bool>() ? true : false;
-			eet->beta = path.eval("number(beta)").getValue<rl::math::Real>(0);
-			eet->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				eet->delta *= rl::math::DEG2RAD;
-			}
-			
-			eet->distanceWeight = path.eval("number(distanceWeight)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
-			eet->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				eet->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			eet->gamma = path.eval("number(gamma)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1) / static_cast<rl::math::Real>(3));
-			eet->goalEpsilon = path.eval("number(goalEpsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
-			
-			if (path.eval("translate(string(goalEpsilon/@orientation), 'TRUE', 'true') = 'true' or string(goalEpsilon/@orientation) = '1'").getValue<bool>())
-			{
-				eet->goalEpsilonUseOrientation = true;
-			}
-			else
-			{
-				eet->goalEpsilonUseOrientation = false;
-			}
-			
-			eet->max.x() = path.eval("number(max/x)").getValue<rl::math::Real>(0);
-			eet->max.y() = path.eval("number(max/y)").getValue<rl::math::Real>(0);
-			eet->max.z() = path.eval("number(max/z)").getValue<rl::math::Real>(0);
-			eet->min.x() = path.eval("number(min/x)").getValue<rl::math::Real>(0);
-			eet->min.y() = path.eval("number(min/y)").getValue<rl::math::Real>(0);
-			eet->min.z() = path.eval("number(min/z)").getValue<rl::math::Real>(0);
-			eet->sampler = this->sampler.get();
-			
-			if (path.eval("count(seed) > 0").getValue<bool>())
-			{
-				eet->seed(
-					path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
-				);
-			}
-			else if (this->seed)
-			{
-				eet->seed(*this->seed);
-			}
-			
-			rl::xml::NodeSet explorers = path.eval("explorer").getValue<rl::xml::NodeSet>();
-			
-			for (int i = 0; i < explorers.size(); ++i)
-			{
-				rl::xml::Path path(document, explorers[i]);
-				
-				std::shared_ptr<rl::plan::WorkspaceSphereExplorer> explorer = std::make_shared<rl::plan::WorkspaceSphereExplorer>();
-				this->explorers.push_back(explorer);
-				eet->explorers.push_back(explorer.get());
-				
-				rl::plan::Eet::ExplorerSetup explorerSetup;
-				
-				std::shared_ptr<rl::math::Vector3> explorerStart = std::make_shared<rl::math::Vector3>();
-				this->explorerStarts.push_back(explorerStart);
-				explorer->start = explorerStart.get();
-				
-				(*explorerStart).x() = path.eval("number(start/x)").getValue<rl::math::Real>(0);
-				(*explorerStart).y() = path.eval("number(start/y)").getValue<rl::math::Real>(0);
-				(*explorerStart).z() = path.eval("number(start/z)").getValue<rl::math::Real>(0);
-				
-				if (path.eval("count(start/goal) > 0").getValue<bool>())
-				{
-					explorerSetup.startConfiguration = this->goal.get();
-				}
-				else if (path.eval("count(start/start) > 0").getValue<bool>())
-				{
-					explorerSetup.startConfiguration = this->start.get();
-				}
-				else
-				{
-					explorerSetup.startConfiguration = nullptr;
-				}
-				
-				if (path.eval("count(start//frame) > 0").getValue<bool>())
-				{
-					explorerSetup.startFrame = path.eval("number(start//frame)").getValue<std::size_t>();
-				}
-				else if (path.eval("count(start//tcp) > 0").getValue<bool>())
-				{
-					explorerSetup.startFrame = -1;
-				}
-				
-				std::shared_ptr<rl::math::Vector3> explorerGoal = std::make_shared<rl::math::Vector3>();
-				this->explorerGoals.push_back(explorerGoal);
-				explorer->goal = explorerGoal.get();
-				
-				(*explorerGoal).x() = path.eval("number(goal/x)").getValue<rl::math::Real>(0);
-				(*explorerGoal).y() = path.eval("number(goal/y)").getValue<rl::math::Real>(0);
-				(*explorerGoal).z() = path.eval("number(goal/z)").getValue<rl::math::Real>(0);
-				
-				if (path.eval("count(goal/goal) > 0").getValue<bool>())
-				{
-					explorerSetup.goalConfiguration = this->goal.get();
-				}
-				else if (path.eval("count(goal/start) > 0").getValue<bool>())
-				{
-					explorerSetup.goalConfiguration = this->start.get();
-				}
-				else
-				{
-					explorerSetup.goalConfiguration = nullptr;
-				}
-				
-				if (path.eval("count(goal//frame) > 0").getValue<bool>())
-				{
-					explorerSetup.goalFrame = path.eval("number(goal//frame)").getValue<std::size_t>();
-				}
-				else if (path.eval("count(goal//tcp) > 0").getValue<bool>())
-				{
-					explorerSetup.goalFrame = -1;
-				}
-				
-				explorer->boundingBox.max().x() = path.eval("number(boundingBox/max/x)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-				explorer->boundingBox.max().y() = path.eval("number(boundingBox/max/y)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-				explorer->boundingBox.max().z() = path.eval("number(boundingBox/max/z)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-				explorer->boundingBox.min().x() = path.eval("number(boundingBox/min/x)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
-				explorer->boundingBox.min().y() = path.eval("number(boundingBox/min/y)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
-				explorer->boundingBox.min().z() = path.eval("number(boundingBox/min/z)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
-				
-				if (path.eval("count(distance) > 0").getValue<bool>())
-				{
-					explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_DISTANCE;
-				}
-				else if (path.eval("count(sourceDistance) > 0").getValue<bool>())
-				{
-					explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_SOURCE_DISTANCE;
-				}
-				else if (path.eval("count(space) > 0").getValue<bool>())
-				{
-					explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_SPACE;
-				}
-				
-				if (rl::plan::DistanceModel* model = dynamic_cast<rl::plan::DistanceModel*>(this->model.get()))
-				{
-					explorer->model = model;
-				}
-				else
-				{
-					throw std::runtime_error("selected engine does not support distance queries");
-				}
-				
-				explorer->radius = path.eval("number(radius)").getValue<rl::math::Real>(0);
-				explorer->range = path.eval("number(range)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-				explorer->samples = path.eval("number(samples)").getValue<std::size_t>(10);
-				
-				if (path.eval("count(seed) > 0").getValue<bool>())
-				{
-					explorer->seed(
-						path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
-					);
-				}
-				else if (this->seed)
-				{
-					explorer->seed(*this->seed);
-				}
-				
-				eet->explorersSetup.push_back(explorerSetup);
-			}
-		}
-		else if ("prm" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::Prm>();
-			rl::plan::Prm* prm = static_cast<rl::plan::Prm*>(this->planner.get());
-			prm->degree = path.eval("number(degree)").getValue<std::size_t>(std::numeric_limits<std::size_t>::max());
-			
-			if (path.eval("count(dijkstra) > 0").getValue<bool>())
-			{
-				prm->astar = false;
-			}
-			
-			prm->k = path.eval("number(k)").getValue<std::size_t>(30);
-			prm->radius = path.eval("number(radius)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-			
-			if ("deg" == path.eval("string(radius/@unit)").getValue<std::string>())
-			{
-				prm->radius *= rl::math::DEG2RAD;
-			}
-			
-			prm->sampler = this->sampler.get();
-			prm->verifier = this->verifier.get();
-		}
-		else if ("prmUtilityGuided" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::PrmUtilityGuided>();
-			rl::plan::PrmUtilityGuided* prmUtilityGuided = static_cast<rl::plan::PrmUtilityGuided*>(this->planner.get());
-			prmUtilityGuided->degree = path.eval("number(degree)").getValue<std::size_t>(std::numeric_limits<std::size_t>::max());
-			
-			if (path.eval("count(dijkstra) > 0").getValue<bool>())
-			{
-				prmUtilityGuided->astar = false;
-			}
-			
-			prmUtilityGuided->k = path.eval("number(k)").getValue<std::size_t>(30);
-			prmUtilityGuided->radius = path.eval("number(radius)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
-			
-			if ("deg" == path.eval("string(radius/@unit)").getValue<std::string>())
-			{
-				prmUtilityGuided->radius *= rl::math::DEG2RAD;
-			}
-			
-			if (path.eval("count(seed) > 0").getValue<bool>())
-			{
-				prmUtilityGuided->seed(
-					path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
-				);
-			}
-			else if (this->seed)
-			{
-				prmUtilityGuided->seed(*this->seed);
-			}
-			
-			prmUtilityGuided->sampler = this->sampler.get();
-			prmUtilityGuided->verifier = this->verifier.get();
-		}
-		else if ("rrt" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::Rrt>();
-			rl::plan::Rrt* rrt = static_cast<rl::plan::Rrt*>(this->planner.get());
-			rrt->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrt->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrt->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrt->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrt->sampler = this->sampler.get();
-		}
-		else if ("rrtCon" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtCon>();
-			rl::plan::RrtCon* rrtCon = static_cast<rl::plan::RrtCon*>(this->planner.get());
-			rrtCon->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtCon->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtCon->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtCon->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtCon->probability = path.eval("number(probability)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
-			rrtCon->sampler = this->sampler.get();
-			
-			if (path.eval("count(seed) > 0").getValue<bool>())
-			{
-				rrtCon->seed(
-					path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
-				);
-			}
-			else if (this->seed)
-			{
-				rrtCon->seed(*this->seed);
-			}
-		}
-		else if ("rrtConCon" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtConCon>();
-			rl::plan::RrtConCon* rrtConCon = static_cast<rl::plan::RrtConCon*>(this->planner.get());
-			rrtConCon->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtConCon->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtConCon->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtConCon->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtConCon->sampler = this->sampler.get();
-		}
-		else if ("rrtDual" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtDual>();
-			rl::plan::RrtDual* rrtDual = static_cast<rl::plan::RrtDual*>(this->planner.get());
-			rrtDual->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtDual->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtDual->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtDual->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtDual->sampler = this->sampler.get();
-		}
-		else if ("rrtExtCon" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtExtCon>();
-			rl::plan::RrtExtCon* rrtExtCon = static_cast<rl::plan::RrtExtCon*>(this->planner.get());
-			rrtExtCon->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtExtCon->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtExtCon->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtExtCon->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtExtCon->sampler = this->sampler.get();
-		}
-		else if ("rrtExtExt" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtExtExt>();
-			rl::plan::RrtExtExt* rrtExtExt = static_cast<rl::plan::RrtExtExt*>(this->planner.get());
-			rrtExtExt->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtExtExt->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtExtExt->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtExtExt->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtExtExt->sampler = this->sampler.get();
-		}
-		else if ("rrtGoalBias" == planners[i].getName())
-		{
-			this->planner = std::make_shared<rl::plan::RrtGoalBias>();
-			rl::plan::RrtGoalBias* rrtGoalBias = static_cast<rl::plan::RrtGoalBias*>(this->planner.get());
-			rrtGoalBias->delta = path.eval("number(delta)").getValue<rl::math::Real>(1);
-			
-			if ("deg" == path.eval("string(delta/@unit)").getValue<std::string>())
-			{
-				rrtGoalBias->delta *= rl::math::DEG2RAD;
-			}
-			
-			rrtGoalBias->epsilon = path.eval("number(epsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1.0e-3));
-			
-			if ("deg" == path.eval("string(epsilon/@unit)").getValue<std::string>())
-			{
-				rrtGoalBias->epsilon *= rl::math::DEG2RAD;
-			}
-			
-			rrtGoalBias->probability = path.eval("number(probability)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
-			rrtGoalBias->sampler = this->sampler.get();
-			
-			if (path.eval("count(seed) > 0").getValue<bool>())
-			{
-				rrtGoalBias->seed(
-					path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
-				);
-			}
-			else if (this->seed)
-			{
-				rrtGoalBias->seed(*this->seed);
-			}
-		}
-	}
-	
-	std::size_t nearestNeighborsSize = 1;
-	
-	if (rl::plan::RrtDual* rrtDual = dynamic_cast<rl::plan::RrtDual*>(this->planner.get()))
-	{
-		nearestNeighborsSize = 2;
-	}
-	
-	for (::std::size_t i = 0; i < nearestNeighborsSize; ++i)
-	{
-		std::shared_ptr<rl::plan::NearestNeighbors> nearestNeighbors;
-		
-		if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors) > 0").getValue<bool>())
-		{
-			std::shared_ptr<rl::plan::GnatNearestNeighbors> gnatNearestNeighbors = std::make_shared<rl::plan::GnatNearestNeighbors>(this->model.get());
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/checks) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->setChecks(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/checks)").getValue<std::size_t>(0)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/data/@max) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->setNodeDataMax(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/data/@max)").getValue<std::size_t>(50)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->setNodeDegree(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree)").getValue<std::size_t>(8)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@max) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->setNodeDegreeMax(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@max)").getValue<std::size_t>(12)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@min) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->setNodeDegreeMin(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@min)").getValue<std::size_t>(4)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/seed) > 0").getValue<bool>())
-			{
-				gnatNearestNeighbors->seed(
-					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/seed)").getValue<std::mt19937::result_type>(std::random_device()())
-				);
-			}
-			else if (this->seed)
-			{
-				gnatNearestNeighbors->seed(*this->seed);
-			}
-			
-			nearestNeighbors = gnatNearestNeighbors;
-		}
-		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors) > 0").getValue<bool>())
-		{
-			std::shared_ptr<rl::plan::KdtreeBoundingBoxNearestNeighbors> kdtreeBoundingBoxNearestNeighbors = std::make_shared<rl::plan::KdtreeBoundingBoxNearestNeighbors>(this->model.get());
-			
-			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/checks) > 0").getValue<bool>())
-			{
-				kdtreeBoundingBoxNearestNeighbors->setChecks(
-					path.eval("number((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/checks)").getValue<std::size_t>(0)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/node/data/@max) > 0").getValue<bool>())
-			{
-				kdtreeBoundingBoxNearestNeighbors->setNodeDataMax(
-					path.eval("number((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/node/data/@max)").getValue<std::size_t>(10)
-				);
-			}
-			
-			nearestNeighbors = kdtreeBoundingBoxNearestNeighbors;
-		}
-		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors) > 0").getValue<bool>())
-		{
-			std::shared_ptr<rl::plan::KdtreeNearestNeighbors> kdtreeNearestNeighbors = std::make_shared<rl::plan::KdtreeNearestNeighbors>(this->model.get());
-			
-			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/checks) > 0").getValue<bool>())
-			{
-				kdtreeNearestNeighbors->setChecks(
-					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/checks)").getValue<std::size_t>(0)
-				);
-			}
-			
-			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/samples) > 0").getValue<bool>())
-			{
-				kdtreeNearestNeighbors->setSamples(
-					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/samples)").getValue<std::size_t>(100)
-				);
-			}
-			
-			nearestNeighbors = kdtreeNearestNeighbors;
-		}
-		else
-		{
-			std::shared_ptr<rl::plan::LinearNearestNeighbors> linearNearestNeighbors = std::make_shared<rl::plan::LinearNearestNeighbors>(this->model.get());
-			nearestNeighbors = linearNearestNeighbors;
-		}
-		
-		this->nearestNeighbors.push_back(nearestNeighbors);
-		
-		if (rl::plan::Prm* prm = dynamic_cast<rl::plan::Prm*>(this->planner.get()))
-		{
-			prm->setNearestNeighbors(nearestNeighbors.get());
-		}
-		else if (rl::plan::Rrt* rrt = dynamic_cast<rl::plan::Rrt*>(this->planner.get()))
-		{
-			rrt->setNearestNeighbors(nearestNeighbors.get(), i);
-		}
-	}
-	
-	this->planner->duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-		std::chrono::duration<float>(
-			path.eval("number((/rl/plan|/rlplan)//duration)").getValue<rl::math::Real>(std::numeric_limits<float>::max())
-		)
-	);
-	
-	this->planner->goal = this->goal.get();
-	this->planner->model = this->model.get();
-	this->planner->start = this->start.get();
-	
 	this->viewer->delta = path.eval("number((/rl/plan|/rlplan)//viewer/delta)").getValue<rl::math::Real>();
 	
 	if ("deg" == path.eval("string((/rl/plan|/rlplan)//viewer/delta/@unit)").getValue<std::string>())
@@ -1965,13 +1077,11 @@ MainWindow::open()
 void
 MainWindow::reset()
 {
-	std::chrono::steady_clock::duration duration = this->planner->duration;
-	
 	this->thread->blockSignals(true);
 	QCoreApplication::processEvents();
-	this->planner->duration = std::chrono::steady_clock::duration::zero();
+	this->planner->canceled = true;
 	this->thread->stop();
-	this->planner->duration = duration;
+	this->planner->canceled = false;
 	this->thread->blockSignals(false);
 	
 	this->planner->reset();
@@ -48,6 +48,8 @@
 #include <rl/sg/Scene.h>
 #include <rl/sg/so/Scene.h>
 
+#include "Scenario.h"
+
 class ConfigurationDelegate;
 class ConfigurationModel;
 class ConfigurationSpaceModel;
@@ -80,6 +82,8 @@ public:
 	
 	std::shared_ptr<rl::math::Vector> goal;
 	
+	std::vector<Scenario::Instance> instances;
+	
 	std::shared_ptr<rl::kin::Kinematics> kin;
 	
 	std::shared_ptr<rl::kin::Kinematics> kin2;
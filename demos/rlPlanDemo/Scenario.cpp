@@ -0,0 +1,972 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <rl/math/Rotation.h>
+#include <rl/math/Unit.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/AddRrtConCon.h>
+#include <rl/plan/AdvancedOptimizer.h>
+#include <rl/plan/BridgeSampler.h>
+#include <rl/plan/ContinuousVerifier.h>
+#include <rl/plan/DistanceModel.h>
+#include <rl/plan/DistanceVerifier.h>
+#include <rl/plan/Eet.h>
+#include <rl/plan/GaussianSampler.h>
+#include <rl/plan/GnatNearestNeighbors.h>
+#include <rl/plan/HaltonSampler.h>
+#include <rl/plan/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/plan/KdtreeNearestNeighbors.h>
+#include <rl/plan/LazyPrm.h>
+#include <rl/plan/LinearNearestNeighbors.h>
+#include <rl/plan/Prm.h>
+#include <rl/plan/PrmUtilityGuided.h>
+#include <rl/plan/ParallelVerifier.h>
+#include <rl/plan/RecursiveVerifier.h>
+#include <rl/plan/Rrt.h>
+#include <rl/plan/RrtCon.h>
+#include <rl/plan/RrtConCon.h>
+#include <rl/plan/RrtDual.h>
+#include <rl/plan/RrtExtCon.h>
+#include <rl/plan/RrtExtExt.h>
+#include <rl/plan/RrtGoalBias.h>
+#include <rl/plan/SequentialVerifier.h>
+#include <rl/plan/ShortcutOptimizer.h>
+#include <rl/plan/SimpleOptimizer.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/plan/VectorizedLinearNearestNeighbors.h>
+#include <rl/sg/SimpleScene.h>
+#include <rl/sg/XmlFactory.h>
+#include <rl/xml/DomParser.h>
+#include <rl/xml/Node.h>
+#include <rl/xml/Object.h>
+#include <rl/xml/Stylesheet.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+#include "Scenario.h"
+
+Scenario::Scenario() :
+	explorerGoals(),
+	explorers(),
+	explorerStarts(),
+	goal(),
+	instances(),
+	kin(),
+	mdl(),
+	model(),
+	nearestNeighbors(),
+	optimizer(),
+	planner(),
+	sampler(),
+	scene(),
+	sigma(),
+	start(),
+	verifier(),
+	verifier2()
+{
+}
+
+Scenario::~Scenario()
+{
+}
+
+std::shared_ptr<rl::plan::Verifier>
+Scenario::createParallelVerifier() const
+{
+	std::shared_ptr<rl::plan::ParallelVerifier> parallelVerifier = std::make_shared<rl::plan::ParallelVerifier>();
+	
+	if (this->instances.size() > 1)
+	{
+		for (std::size_t i = 0; i < this->instances.size(); ++i)
+		{
+			parallelVerifier->models.push_back(this->instances[i].model.get());
+		}
+	}
+	
+	return parallelVerifier;
+}
+
+void
+Scenario::load(const rl::xml::Document& document, const std::string& engine, const boost::optional<std::size_t>& seed)
+{
+	rl::xml::Path path(document);
+	
+	this->instances.resize(
+		std::max<std::size_t>(1, path.eval("number((/rl/plan|/rlplan)//model/threads)").getValue<std::size_t>(1))
+	);
+	
+	for (std::size_t i = 0; i < this->instances.size(); ++i)
+	{
+		Scenario::loadInstance(path, engine, this->instances[i]);
+	}
+	
+	this->kin = this->instances[0].kin;
+	this->mdl = this->instances[0].mdl;
+	this->model = this->instances[0].model;
+	this->scene = this->instances[0].scene;
+	
+	this->start = std::make_shared<rl::math::Vector>(Scenario::loadConfiguration(path.eval("(/rl/plan|/rlplan)//start/q").getValue<rl::xml::NodeSet>()));
+	this->goal = std::make_shared<rl::math::Vector>(Scenario::loadConfiguration(path.eval("(/rl/plan|/rlplan)//goal/q").getValue<rl::xml::NodeSet>()));
+	
+	if (path.eval("count((/rl/plan|/rlplan)//sigma) > 0").getValue<bool>())
+	{
+		this->sigma = std::make_shared<rl::math::Vector>(Scenario::loadConfiguration(path.eval("(/rl/plan|/rlplan)//sigma/q").getValue<rl::xml::NodeSet>()));
+	}
+	
+	if (path.eval("count((/rl/plan|/rlplan)//uniformSampler) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::UniformSampler> uniformSampler = std::make_shared<rl::plan::UniformSampler>();
+		
+		if (path.eval("count((/rl/plan|/rlplan)//uniformSampler/seed) > 0").getValue<bool>())
+		{
+			uniformSampler->seed(
+				path.eval("number((/rl/plan|/rlplan)//uniformSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			uniformSampler->seed(*seed);
+		}
+		
+		this->sampler = uniformSampler;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//gaussianSampler) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::GaussianSampler> gaussianSampler = std::make_shared<rl::plan::GaussianSampler>();
+		
+		if (path.eval("count((/rl/plan|/rlplan)//gaussianSampler/seed) > 0").getValue<bool>())
+		{
+			gaussianSampler->seed(
+				path.eval("number((/rl/plan|/rlplan)//gaussianSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			gaussianSampler->seed(*seed);
+		}
+		
+		gaussianSampler->sigma = this->sigma.get();
+		this->sampler = gaussianSampler;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//bridgeSampler) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::BridgeSampler> bridgeSampler = std::make_shared<rl::plan::BridgeSampler>();
+		bridgeSampler->ratio = path.eval("number((/rl/plan|/rlplan)//bridgeSampler/ratio)").getValue<rl::math::Real>(static_cast<rl::math::Real>(5) / static_cast<rl::math::Real>(6));
+		
+		if (path.eval("count((/rl/plan|/rlplan)//bridgeSampler/seed) > 0").getValue<bool>())
+		{
+			bridgeSampler->seed(
+				path.eval("number((/rl/plan|/rlplan)//bridgeSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			bridgeSampler->seed(*seed);
+		}
+		
+		bridgeSampler->sigma = this->sigma.get();
+		this->sampler = bridgeSampler;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//haltonSampler) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::HaltonSampler> haltonSampler = std::make_shared<rl::plan::HaltonSampler>();
+		haltonSampler->scrambled = !path.eval("translate(string((/rl/plan|/rlplan)//haltonSampler/scrambled), 'FALSE', 'false') = 'false' or string((/rl/plan|/rlplan)//haltonSampler/scrambled) = '0'").getValue<bool>();
+		
+		if (path.eval("count((/rl/plan|/rlplan)//haltonSampler/seed) > 0").getValue<bool>())
+		{
+			haltonSampler->seed(
+				path.eval("number((/rl/plan|/rlplan)//haltonSampler/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			haltonSampler->seed(*seed);
+		}
+		
+		this->sampler = haltonSampler;
+	}
+	
+	if (nullptr != this->sampler)
+	{
+		this->sampler->model = this->model.get();
+		
+		if (this->instances.size() > 1)
+		{
+			for (std::size_t i = 0; i < this->instances.size(); ++i)
+			{
+				this->sampler->models.push_back(this->instances[i].model.get());
+			}
+		}
+	}
+	
+	if (path.eval("count((/rl/plan|/rlplan)//continuousVerifier) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::ContinuousVerifier> continuousVerifier = std::make_shared<rl::plan::ContinuousVerifier>();
+		continuousVerifier->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//continuousVerifier/delta", 1);
+		continuousVerifier->tolerance = path.eval("number((/rl/plan|/rlplan)//continuousVerifier/tolerance)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
+		this->verifier = continuousVerifier;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//distanceVerifier) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::DistanceVerifier> distanceVerifier = std::make_shared<rl::plan::DistanceVerifier>();
+		distanceVerifier->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//distanceVerifier/delta", 1);
+		distanceVerifier->radius = path.eval("number((/rl/plan|/rlplan)//distanceVerifier/radius)").getValue<rl::math::Real>(0);
+		this->verifier = distanceVerifier;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//parallelVerifier) > 0").getValue<bool>())
+	{
+		this->verifier = this->createParallelVerifier();
+		this->verifier->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//parallelVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//recursiveVerifier) > 0").getValue<bool>())
+	{
+		this->verifier = std::make_shared<rl::plan::RecursiveVerifier>();
+		this->verifier->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//recursiveVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//sequentialVerifier) > 0").getValue<bool>())
+	{
+		this->verifier = std::make_shared<rl::plan::SequentialVerifier>();
+		this->verifier->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//sequentialVerifier/delta", 1);
+	}
+	
+	if (nullptr != this->verifier)
+	{
+		this->verifier->model = this->model.get();
+	}
+	
+	if (path.eval("count((/rl/plan|/rlplan)//simpleOptimizer/recursiveVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//simpleOptimizer/recursiveVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//simpleOptimizer/parallelVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = this->createParallelVerifier();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//simpleOptimizer/parallelVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//advancedOptimizer/recursiveVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//advancedOptimizer/recursiveVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//advancedOptimizer/parallelVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = this->createParallelVerifier();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//advancedOptimizer/parallelVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer/recursiveVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//shortcutOptimizer/recursiveVerifier/delta", 1);
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer/parallelVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = this->createParallelVerifier();
+		this->verifier2->delta = Scenario::loadReal(path, "(/rl/plan|/rlplan)//shortcutOptimizer/parallelVerifier/delta", 1);
+	}
+	
+	if (nullptr != this->verifier2)
+	{
+		this->verifier2->model = this->model.get();
+	}
+	
+	if (path.eval("count((/rl/plan|/rlplan)//simpleOptimizer) > 0").getValue<bool>())
+	{
+		this->optimizer = std::make_shared<rl::plan::SimpleOptimizer>();
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//advancedOptimizer) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::AdvancedOptimizer> advancedOptimizer = std::make_shared<rl::plan::AdvancedOptimizer>();
+		advancedOptimizer->length = Scenario::loadReal(path, "(/rl/plan|/rlplan)//advancedOptimizer/length", 1);
+		advancedOptimizer->ratio = path.eval("number((/rl/plan|/rlplan)//advancedOptimizer/ratio)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
+		this->optimizer = advancedOptimizer;
+	}
+	else if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer) > 0").getValue<bool>())
+	{
+		std::shared_ptr<rl::plan::ShortcutOptimizer> shortcutOptimizer = std::make_shared<rl::plan::ShortcutOptimizer>();
+		shortcutOptimizer->iterations = path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/iterations)").getValue<std::size_t>(100);
+		shortcutOptimizer->shortcuts = path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/shortcuts)").getValue<std::size_t>(64);
+		
+		if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer/seed) > 0").getValue<bool>())
+		{
+			shortcutOptimizer->seed(
+				path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			shortcutOptimizer->seed(*seed);
+		}
+		
+		this->optimizer = shortcutOptimizer;
+	}
+	
+	if (nullptr != this->optimizer)
+	{
+		this->optimizer->model = this->model.get();
+		this->optimizer->verifier = this->verifier2.get();
+	}
+	
+	rl::xml::NodeSet planners = path.eval("(/rl/plan|/rlplan)//addRrtConCon|(/rl/plan|/rlplan)//eet|(/rl/plan|/rlplan)//lazyPrm|(/rl/plan|/rlplan)//prm|(/rl/plan|/rlplan)//prmUtilityGuided|(/rl/plan|/rlplan)//rrt|(/rl/plan|/rlplan)//rrtCon|(/rl/plan|/rlplan)//rrtConCon|(/rl/plan|/rlplan)//rrtDual|(/rl/plan|/rlplan)//rrtGoalBias|(/rl/plan|/rlplan)//rrtExtCon|(/rl/plan|/rlplan)//rrtExtExt").getValue<rl::xml::NodeSet>();
+	
+	if (planners.size() < 1)
+	{
+		throw std::runtime_error("plan document without planner");
+	}
+	
+	rl::xml::Path plannerPath(document, planners[0]);
+	
+	if ("addRrtConCon" == planners[0].getName())
+	{
+		std::shared_ptr<rl::plan::AddRrtConCon> addRrtConCon = std::make_shared<rl::plan::AddRrtConCon>();
+		addRrtConCon->alpha = plannerPath.eval("number(alpha)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
+		addRrtConCon->delta = Scenario::loadReal(plannerPath, "delta", 1);
+		addRrtConCon->epsilon = Scenario::loadReal(plannerPath, "epsilon", static_cast<rl::math::Real>(1.0e-3));
+		addRrtConCon->lower = Scenario::loadReal(plannerPath, "lower", 2);
+		addRrtConCon->radius = Scenario::loadReal(plannerPath, "radius", 20);
+		addRrtConCon->sampler = this->sampler.get();
+		this->planner = addRrtConCon;
+	}
+	else if ("eet" == planners[0].getName())
+	{
+		std::shared_ptr<rl::plan::Eet> eet = std::make_shared<rl::plan::Eet>();
+		eet->alpha = plannerPath.eval("number(alpha)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.01));
+		eet->alternativeDistanceComputation = plannerPath.eval("count(alternativeDistanceComputation) > 0").getValue<bool>();
+		eet->beta = plannerPath.eval("number(beta)").getValue<rl::math::Real>(0);
+		eet->delta = Scenario::loadReal(plannerPath, "delta", 1);
+		eet->distanceWeight = plannerPath.eval("number(distanceWeight)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
+		eet->epsilon = Scenario::loadReal(plannerPath, "epsilon", static_cast<rl::math::Real>(1.0e-3));
+		eet->gamma = plannerPath.eval("number(gamma)").getValue<rl::math::Real>(static_cast<rl::math::Real>(1) / static_cast<rl::math::Real>(3));
+		eet->goalEpsilon = plannerPath.eval("number(goalEpsilon)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1));
+		eet->goalEpsilonUseOrientation = plannerPath.eval("translate(string(goalEpsilon/@orientation), 'TRUE', 'true') = 'true' or string(goalEpsilon/@orientation) = '1'").getValue<bool>();
+		eet->max.x() = plannerPath.eval("number(max/x)").getValue<rl::math::Real>(0);
+		eet->max.y() = plannerPath.eval("number(max/y)").getValue<rl::math::Real>(0);
+		eet->max.z() = plannerPath.eval("number(max/z)").getValue<rl::math::Real>(0);
+		eet->min.x() = plannerPath.eval("number(min/x)").getValue<rl::math::Real>(0);
+		eet->min.y() = plannerPath.eval("number(min/y)").getValue<rl::math::Real>(0);
+		eet->min.z() = plannerPath.eval("number(min/z)").getValue<rl::math::Real>(0);
+		eet->sampler = this->sampler.get();
+		
+		if (plannerPath.eval("count(seed) > 0").getValue<bool>())
+		{
+			eet->seed(
+				plannerPath.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (seed)
+		{
+			eet->seed(*seed);
+		}
+		
+		rl::xml::NodeSet explorers = plannerPath.eval("explorer").getValue<rl::xml::NodeSet>();
+		
+		for (int i = 0; i < explorers.size(); ++i)
+		{
+			rl::xml::Path path(document, explorers[i]);
+			
+			std::shared_ptr<rl::plan::WorkspaceSphereExplorer> explorer = std::make_shared<rl::plan::WorkspaceSphereExplorer>();
+			this->explorers.push_back(explorer);
+			eet->explorers.push_back(explorer.get());
+			
+			rl::plan::Eet::ExplorerSetup explorerSetup;
+			
+			std::shared_ptr<rl::math::Vector3> explorerStart = std::make_shared<rl::math::Vector3>();
+			this->explorerStarts.push_back(explorerStart);
+			explorer->start = explorerStart.get();
+			
+			explorerStart->x() = path.eval("number(start/x)").getValue<rl::math::Real>(0);
+			explorerStart->y() = path.eval("number(start/y)").getValue<rl::math::Real>(0);
+			explorerStart->z() = path.eval("number(start/z)").getValue<rl::math::Real>(0);
+			
+			if (path.eval("count(start/goal) > 0").getValue<bool>())
+			{
+				explorerSetup.startConfiguration = this->goal.get();
+			}
+			else if (path.eval("count(start/start) > 0").getValue<bool>())
+			{
+				explorerSetup.startConfiguration = this->start.get();
+			}
+			else
+			{
+				explorerSetup.startConfiguration = nullptr;
+			}
+			
+			if (path.eval("count(start//frame) > 0").getValue<bool>())
+			{
+				explorerSetup.startFrame = path.eval("number(start//frame)").getValue<std::size_t>();
+			}
+			else if (path.eval("count(start//tcp) > 0").getValue<bool>())
+			{
+				explorerSetup.startFrame = -1;
+			}
+			
+			std::shared_ptr<rl::math::Vector3> explorerGoal = std::make_shared<rl::math::Vector3>();
+			this->explorerGoals.push_back(explorerGoal);
+			explorer->goal = explorerGoal.get();
+			
+			explorerGoal->x() = path.eval("number(goal/x)").getValue<rl::math::Real>(0);
+			explorerGoal->y() = path.eval("number(goal/y)").getValue<rl::math::Real>(0);
+			explorerGoal->z() = path.eval("number(goal/z)").getValue<rl::math::Real>(0);
+			
+			if (path.eval("count(goal/goal) > 0").getValue<bool>())
+			{
+				explorerSetup.goalConfiguration = this->goal.get();
+			}
+			else if (path.eval("count(goal/start) > 0").getValue<bool>())
+			{
+				explorerSetup.goalConfiguration = this->start.get();
+			}
+			else
+			{
+				explorerSetup.goalConfiguration = nullptr;
+			}
+			
+			if (path.eval("count(goal//frame) > 0").getValue<bool>())
+			{
+				explorerSetup.goalFrame = path.eval("number(goal//frame)").getValue<std::size_t>();
+			}
+			else if (path.eval("count(goal//tcp) > 0").getValue<bool>())
+			{
+				explorerSetup.goalFrame = -1;
+			}
+			
+			explorer->boundingBox.max().x() = path.eval("number(boundingBox/max/x)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
+			explorer->boundingBox.max().y() = path.eval("number(boundingBox/max/y)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
+			explorer->boundingBox.max().z() = path.eval("number(boundingBox/max/z)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
+			explorer->boundingBox.min().x() = path.eval("number(boundingBox/min/x)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
+			explorer->boundingBox.min().y() = path.eval("number(boundingBox/min/y)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
+			explorer->boundingBox.min().z() = path.eval("number(boundingBox/min/z)").getValue<rl::math::Real>(-std::numeric_limits<rl::math::Real>::max());
+			
+			if (path.eval("count(distance) > 0").getValue<bool>())
+			{
+				explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_DISTANCE;
+			}
+			else if (path.eval("count(sourceDistance) > 0").getValue<bool>())
+			{
+				explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_SOURCE_DISTANCE;
+			}
+			else if (path.eval("count(space) > 0").getValue<bool>())
+			{
+				explorer->greedy = rl::plan::WorkspaceSphereExplorer::GREEDY_SPACE;
+			}
+			
+			if (rl::plan::DistanceModel* model = dynamic_cast<rl::plan::DistanceModel*>(this->model.get()))
+			{
+				explorer->model = model;
+			}
+			else
+			{
+				throw std::runtime_error("selected engine does not support distance queries");
+			}
+			
+			explorer->radius = path.eval("number(radius)").getValue<rl::math::Real>(0);
+			explorer->range = path.eval("number(range)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
+			explorer->samples = path.eval("number(samples)").getValue<std::size_t>(10);
+			
+			if (path.eval("count(seed) > 0").getValue<bool>())
+			{
+				explorer->seed(
+					path.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
+				);
+			}
+			else if (seed)
+			{
+				explorer->seed(*seed);
+			}
+			
+			eet->explorersSetup.push_back(explorerSetup);
+		}
+		
+		this->planner = eet;
+	}
+	else if ("lazyPrm" == planners[0].getName() || "prm" == planners[0].getName() || "prmUtilityGuided" == planners[0].getName())
+	{
+		std::shared_ptr<rl::plan::Prm> prm;
+		
+		if ("lazyPrm" == planners[0].getName())
+		{
+			prm = std::make_shared<rl::plan::LazyPrm>();
+		}
+		else if ("prmUtilityGuided" == planners[0].getName())
+		{
+			std::shared_ptr<rl::plan::PrmUtilityGuided> prmUtilityGuided = std::make_shared<rl::plan::PrmUtilityGuided>();
+			
+			if (plannerPath.eval("count(seed) > 0").getValue<bool>())
+			{
+				prmUtilityGuided->seed(
+					plannerPath.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
+				);
+			}
+			else if (seed)
+			{
+				prmUtilityGuided->seed(*seed);
+			}
+			
+			prm = prmUtilityGuided;
+		}
+		else
+		{
+			prm = std::make_shared<rl::plan::Prm>();
+		}
+		
+		prm->astar = !plannerPath.eval("count(dijkstra) > 0").getValue<bool>();
+		prm->degree = plannerPath.eval("number(degree)").getValue<std::size_t>(std::numeric_limits<std::size_t>::max());
+		prm->k = plannerPath.eval("number(k)").getValue<std::size_t>(30);
+		prm->radius = Scenario::loadReal(plannerPath, "radius", std::numeric_limits<rl::math::Real>::max());
+		prm->sampler = this->sampler.get();
+		prm->verifier = this->verifier.get();
+		this->planner = prm;
+	}
+	else
+	{
+		std::shared_ptr<rl::plan::Rrt> rrt;
+		
+		if ("rrtCon" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtCon>();
+		}
+		else if ("rrtConCon" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtConCon>();
+		}
+		else if ("rrtDual" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtDual>();
+		}
+		else if ("rrtExtCon" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtExtCon>();
+		}
+		else if ("rrtExtExt" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtExtExt>();
+		}
+		else if ("rrtGoalBias" == planners[0].getName())
+		{
+			rrt = std::make_shared<rl::plan::RrtGoalBias>();
+		}
+		else
+		{
+			rrt = std::make_shared<rl::plan::Rrt>();
+		}
+		
+		rrt->delta = Scenario::loadReal(plannerPath, "delta", 1);
+		rrt->epsilon = Scenario::loadReal(plannerPath, "epsilon", static_cast<rl::math::Real>(1.0e-3));
+		rrt->sampler = this->sampler.get();
+		
+		if (rl::plan::RrtGoalBias* rrtGoalBias = dynamic_cast<rl::plan::RrtGoalBias*>(rrt.get()))
+		{
+			rrtGoalBias->probability = plannerPath.eval("number(probability)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.05));
+			
+			if (plannerPath.eval("count(seed) > 0").getValue<bool>())
+			{
+				rrtGoalBias->seed(
+					plannerPath.eval("number(seed)").getValue<std::mt19937::result_type>(std::random_device()())
+				);
+			}
+			else if (seed)
+			{
+				rrtGoalBias->seed(*seed);
+			}
+		}
+		
+		this->planner = rrt;
+	}
+	
+	std::size_t nearestNeighborsSize = nullptr != dynamic_cast<rl::plan::RrtDual*>(this->planner.get()) ? 2 : 1;
+	
+	for (std::size_t i = 0; i < nearestNeighborsSize; ++i)
+	{
+		std::shared_ptr<rl::plan::NearestNeighbors> nearestNeighbors;
+		
+		if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors) > 0").getValue<bool>())
+		{
+			std::shared_ptr<rl::plan::GnatNearestNeighbors> gnatNearestNeighbors = std::make_shared<rl::plan::GnatNearestNeighbors>(this->model.get());
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/checks) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setChecks(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/checks)").getValue<std::size_t>(0)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/data/@max) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setNodeDataMax(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/data/@max)").getValue<std::size_t>(50)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setNodeDegree(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree)").getValue<std::size_t>(8)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@max) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setNodeDegreeMax(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@max)").getValue<std::size_t>(12)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@min) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setNodeDegreeMin(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/node/degree/@min)").getValue<std::size_t>(4)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/seed) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->seed(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+				);
+			}
+			else if (seed)
+			{
+				gnatNearestNeighbors->seed(*seed);
+			}
+			
+			nearestNeighbors = gnatNearestNeighbors;
+		}
+		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors) > 0").getValue<bool>())
+		{
+			std::shared_ptr<rl::plan::KdtreeBoundingBoxNearestNeighbors> kdtreeBoundingBoxNearestNeighbors = std::make_shared<rl::plan::KdtreeBoundingBoxNearestNeighbors>(this->model.get());
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/checks) > 0").getValue<bool>())
+			{
+				kdtreeBoundingBoxNearestNeighbors->setChecks(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/checks)").getValue<std::size_t>(0)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/node/data/@max) > 0").getValue<bool>())
+			{
+				kdtreeBoundingBoxNearestNeighbors->setNodeDataMax(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/node/data/@max)").getValue<std::size_t>(10)
+				);
+			}
+			
+			nearestNeighbors = kdtreeBoundingBoxNearestNeighbors;
+		}
+		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors) > 0").getValue<bool>())
+		{
+			std::shared_ptr<rl::plan::KdtreeNearestNeighbors> kdtreeNearestNeighbors = std::make_shared<rl::plan::KdtreeNearestNeighbors>(this->model.get());
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/balance) > 0").getValue<bool>())
+			{
+				kdtreeNearestNeighbors->setBalance(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/balance)").getValue<double>(0.75)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/checks) > 0").getValue<bool>())
+			{
+				kdtreeNearestNeighbors->setChecks(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/checks)").getValue<std::size_t>(0)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/samples) > 0").getValue<bool>())
+			{
+				kdtreeNearestNeighbors->setSamples(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/samples)").getValue<std::size_t>(100)
+				);
+			}
+			
+			nearestNeighbors = kdtreeNearestNeighbors;
+		}
+		else if (path.eval("count((/rl/plan|/rlplan)//vectorizedLinearNearestNeighbors) > 0").getValue<bool>())
+		{
+			nearestNeighbors = std::make_shared<rl::plan::VectorizedLinearNearestNeighbors>(this->model.get());
+		}
+		else
+		{
+			nearestNeighbors = std::make_shared<rl::plan::LinearNearestNeighbors>(this->model.get());
+		}
+		
+		this->nearestNeighbors.push_back(nearestNeighbors);
+		
+		if (rl::plan::Prm* prm = dynamic_cast<rl::plan::Prm*>(this->planner.get()))
+		{
+			prm->setNearestNeighbors(nearestNeighbors.get());
+		}
+		else if (rl::plan::Rrt* rrt = dynamic_cast<rl::plan::Rrt*>(this->planner.get()))
+		{
+			rrt->setNearestNeighbors(nearestNeighbors.get(), i);
+		}
+	}
+	
+	this->planner->duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::duration<float>(
+			path.eval("number((/rl/plan|/rlplan)//duration)").getValue<rl::math::Real>(std::numeric_limits<float>::max())
+		)
+	);
+	
+	this->planner->goal = this->goal.get();
+	this->planner->model = this->model.get();
+	this->planner->start = this->start.get();
+}
+
+rl::math::Vector
+Scenario::loadConfiguration(const rl::xml::NodeSet& nodes)
+{
+	rl::math::Vector q(nodes.size());
+	
+	for (int i = 0; i < nodes.size(); ++i)
+	{
+		q(i) = std::atof(nodes[i].getContent().c_str());
+		
+		if ("deg" == nodes[i].getProperty("unit"))
+		{
+			q(i) *= rl::math::DEG2RAD;
+		}
+	}
+	
+	return q;
+}
+
+void
+Scenario::loadInstance(rl::xml::Path& path, const std::string& engine, Instance& instance)
+{
+#ifdef RL_SG_BULLET
+	if ("bullet" == engine)
+	{
+		instance.scene = std::make_shared<rl::sg::bullet::Scene>();
+	}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+	if ("fcl" == engine)
+	{
+		instance.scene = std::make_shared<rl::sg::fcl::Scene>();
+	}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+	if ("ode" == engine)
+	{
+		instance.scene = std::make_shared<rl::sg::ode::Scene>();
+	}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	if ("pqp" == engine)
+	{
+		instance.scene = std::make_shared<rl::sg::pqp::Scene>();
+	}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+	if ("solid" == engine)
+	{
+		instance.scene = std::make_shared<rl::sg::solid::Scene>();
+	}
+#endif // RL_SG_SOLID
+	
+	if (nullptr == instance.scene)
+	{
+		throw std::runtime_error("unknown engine " + engine);
+	}
+	
+	rl::mdl::XmlFactory modelFactory;
+	rl::sg::XmlFactory sceneFactory;
+	
+	rl::xml::NodeSet modelScene = path.eval("(/rl/plan|/rlplan)//model/scene").getValue<rl::xml::NodeSet>();
+	sceneFactory.load(modelScene[0].getUri(modelScene[0].getProperty("href")), instance.scene.get(), true, false);
+	
+	rl::xml::NodeSet kinematics = path.eval("(/rl/plan|/rlplan)//model/kinematics").getValue<rl::xml::NodeSet>();
+	
+	if ("mdl" == path.eval("string((/rl/plan|/rlplan)//model/kinematics/@type)").getValue<std::string>())
+	{
+		instance.mdl = std::dynamic_pointer_cast<rl::mdl::Kinematic>(modelFactory.create(
+			kinematics[0].getUri(kinematics[0].getProperty("href"))
+		));
+		
+		if (path.eval("count((/rl/plan|/rlplan)//model/kinematics/world) > 0").getValue<bool>())
+		{
+			instance.mdl->world() = Scenario::loadWorld(path, "(/rl/plan|/rlplan)//model/kinematics/world");
+		}
+	}
+	else
+	{
+		instance.kin = rl::kin::Kinematics::create(
+			kinematics[0].getUri(kinematics[0].getProperty("href"))
+		);
+		
+		if (path.eval("count((/rl/plan|/rlplan)//model/kinematics/world) > 0").getValue<bool>())
+		{
+			instance.kin->world() = Scenario::loadWorld(path, "(/rl/plan|/rlplan)//model/kinematics/world");
+		}
+	}
+	
+	if (nullptr != dynamic_cast<rl::sg::DistanceScene*>(instance.scene.get()))
+	{
+		instance.model = std::make_shared<rl::plan::DistanceModel>();
+	}
+	else if (nullptr != dynamic_cast<rl::sg::SimpleScene*>(instance.scene.get()))
+	{
+		instance.model = std::make_shared<rl::plan::SimpleModel>();
+	}
+	else
+	{
+		throw std::runtime_error("selected engine does not support collision queries");
+	}
+	
+	if (nullptr != instance.kin)
+	{
+		instance.model->kin = instance.kin.get();
+	}
+	else if (nullptr != instance.mdl)
+	{
+		instance.model->mdl = instance.mdl.get();
+	}
+	
+	instance.model->model = instance.scene->getModel(
+		path.eval("number((/rl/plan|/rlplan)//model/model)").getValue<std::size_t>()
+	);
+	instance.model->scene = instance.scene.get();
+}
+
+rl::math::Real
+Scenario::loadReal(rl::xml::Path& path, const std::string& expression, const rl::math::Real& value)
+{
+	rl::math::Real real = path.eval("number(" + expression + ")").getValue<rl::math::Real>(value);
+	
+	if ("deg" == path.eval("string(" + expression + "/@unit)").getValue<std::string>())
+	{
+		real *= rl::math::DEG2RAD;
+	}
+	
+	return real;
+}
+
+rl::math::Transform
+Scenario::loadWorld(rl::xml::Path& path, const std::string& expression)
+{
+	rl::math::Transform world;
+	
+	world = rl::math::AngleAxis(
+		path.eval("number(" + expression + "/rotation/z)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
+		rl::math::Vector3::UnitZ()
+	) * rl::math::AngleAxis(
+		path.eval("number(" + expression + "/rotation/y)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
+		rl::math::Vector3::UnitY()
+	) * rl::math::AngleAxis(
+		path.eval("number(" + expression + "/rotation/x)").getValue<rl::math::Real>(0) * rl::math::DEG2RAD,
+		rl::math::Vector3::UnitX()
+	);
+	
+	world.translation().x() = path.eval("number(" + expression + "/translation/x)").getValue<rl::math::Real>(0);
+	world.translation().y() = path.eval("number(" + expression + "/translation/y)").getValue<rl::math::Real>(0);
+	world.translation().z() = path.eval("number(" + expression + "/translation/z)").getValue<rl::math::Real>(0);
+	
+	return world;
+}
+
+rl::xml::Document
+Scenario::parse(const std::string& filename)
+{
+	rl::xml::DomParser parser;
+	
+	rl::xml::Document document = parser.readFile(filename, "", XML_PARSE_NOENT | XML_PARSE_XINCLUDE);
+	document.substitute(XML_PARSE_NOENT | XML_PARSE_XINCLUDE);
+	
+	if ("stylesheet" == document.getRootElement().getName() || "transform" == document.getRootElement().getName())
+	{
+		if ("1.0" == document.getRootElement().getProperty("version"))
+		{
+			if (document.getRootElement().hasNamespace() && "http://www.w3.org/1999/XSL/Transform" == document.getRootElement().getNamespace().getHref())
+			{
+				rl::xml::Stylesheet stylesheet(document);
+				document = stylesheet.apply();
+			}
+		}
+	}
+	
+	return document;
+}
+
+void
+Scenario::seed(const std::mt19937::result_type& value)
+{
+	if (rl::plan::UniformSampler* uniformSampler = dynamic_cast<rl::plan::UniformSampler*>(this->sampler.get()))
+	{
+		uniformSampler->seed(value);
+	}
+	else if (rl::plan::HaltonSampler* haltonSampler = dynamic_cast<rl::plan::HaltonSampler*>(this->sampler.get()))
+	{
+		haltonSampler->seed(value);
+	}
+	
+	if (rl::plan::Eet* eet = dynamic_cast<rl::plan::Eet*>(this->planner.get()))
+	{
+		eet->seed(value);
+	}
+	else if (rl::plan::RrtGoalBias* rrtGoalBias = dynamic_cast<rl::plan::RrtGoalBias*>(this->planner.get()))
+	{
+		rrtGoalBias->seed(value);
+	}
+	else if (rl::plan::PrmUtilityGuided* prmUtilityGuided = dynamic_cast<rl::plan::PrmUtilityGuided*>(this->planner.get()))
+	{
+		prmUtilityGuided->seed(value);
+	}
+	
+	for (std::size_t i = 0; i < this->explorers.size(); ++i)
+	{
+		this->explorers[i]->seed(value);
+	}
+	
+	for (std::size_t i = 0; i < this->nearestNeighbors.size(); ++i)
+	{
+		if (rl::plan::GnatNearestNeighbors* gnatNearestNeighbors = dynamic_cast<rl::plan::GnatNearestNeighbors*>(this->nearestNeighbors[i].get()))
+		{
+			gnatNearestNeighbors->seed(value);
+		}
+	}
+	
+	if (rl::plan::ShortcutOptimizer* shortcutOptimizer = dynamic_cast<rl::plan::ShortcutOptimizer*>(this->optimizer.get()))
+	{
+		shortcutOptimizer->seed(value);
+	}
+}
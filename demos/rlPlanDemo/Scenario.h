@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/optional.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/plan/NearestNeighbors.h>
+#include <rl/plan/Optimizer.h>
+#include <rl/plan/Planner.h>
+#include <rl/plan/Sampler.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/Verifier.h>
+#include <rl/plan/WorkspaceSphereExplorer.h>
+#include <rl/sg/Scene.h>
+#include <rl/xml/Document.h>
+#include <rl/xml/NodeSet.h>
+#include <rl/xml/Path.h>
+
+/**
+ * Collision scene, model, and planner of a plan file.
+ * 
+ * Reads everything of a plan file except for the viewer part, so that
+ * rlPlanDemo and rlPlanBenchmark set up identical planners.
+ */
+class Scenario
+{
+public:
+	/**
+	 * Scene, kinematics, and model for collision queries of one thread.
+	 */
+	struct Instance
+	{
+		std::shared_ptr<rl::kin::Kinematics> kin;
+		
+		std::shared_ptr<rl::mdl::Kinematic> mdl;
+		
+		std::shared_ptr<rl::plan::SimpleModel> model;
+		
+		std::shared_ptr<rl::sg::Scene> scene;
+	};
+	
+	Scenario();
+	
+	virtual ~Scenario();
+	
+	/**
+	 * Read a plan file and apply an XSLT stylesheet if present.
+	 */
+	static rl::xml::Document parse(const std::string& filename);
+	
+	/**
+	 * Create scene, model, and planner of a plan document.
+	 * 
+	 * @param[in] engine Collision engine of the scene
+	 * @param[in] seed Seed of randomized components without a seed in the
+	 * plan document
+	 */
+	void load(const rl::xml::Document& document, const std::string& engine, const boost::optional<std::size_t>& seed = boost::none);
+	
+	/**
+	 * Seed all randomized components, overriding seeds of the plan document.
+	 */
+	void seed(const std::mt19937::result_type& value);
+	
+	std::vector<std::shared_ptr<rl::math::Vector3>> explorerGoals;
+	
+	std::vector<std::shared_ptr<rl::plan::WorkspaceSphereExplorer>> explorers;
+	
+	std::vector<std::shared_ptr<rl::math::Vector3>> explorerStarts;
+	
+	std::shared_ptr<rl::math::Vector> goal;
+	
+	/**
+	 * One instance per thread of the plan document, the first one shared
+	 * with kin, mdl, model, and scene.
+	 */
+	std::vector<Instance> instances;
+	
+	std::shared_ptr<rl::kin::Kinematics> kin;
+	
+	std::shared_ptr<rl::mdl::Kinematic> mdl;
+	
+	std::shared_ptr<rl::plan::SimpleModel> model;
+	
+	std::vector<std::shared_ptr<rl::plan::NearestNeighbors>> nearestNeighbors;
+	
+	std::shared_ptr<rl::plan::Optimizer> optimizer;
+	
+	std::shared_ptr<rl::plan::Planner> planner;
+	
+	std::shared_ptr<rl::plan::Sampler> sampler;
+	
+	std::shared_ptr<rl::sg::Scene> scene;
+	
+	std::shared_ptr<rl::math::Vector> sigma;
+	
+	std::shared_ptr<rl::math::Vector> start;
+	
+	std::shared_ptr<rl::plan::Verifier> verifier;
+	
+	std::shared_ptr<rl::plan::Verifier> verifier2;
+	
+protected:
+	
+private:
+	/** Parallel verifier with one thread per instance. */
+	std::shared_ptr<rl::plan::Verifier> createParallelVerifier() const;
+	
+	static rl::math::Vector loadConfiguration(const rl::xml::NodeSet& nodes);
+	
+	static void loadInstance(rl::xml::Path& path, const std::string& engine, Instance& instance);
+	
+	static rl::math::Real loadReal(rl::xml::Path& path, const std::string& expression, const rl::math::Real& value);
+	
+	static rl::math::Transform loadWorld(rl::xml::Path& path, const std::string& expression);
+};
+
+#endif // SCENARIO_H
@@ -37,6 +37,7 @@
 #include <rl/plan/LinearNearestNeighbors.h>
 #include <rl/plan/Prm.h>
 #include <rl/plan/Rrt.h>
+#include <rl/plan/VectorizedLinearNearestNeighbors.h>
 
 #include "MainWindow.h"
 #include "Thread.h"
@@ -269,6 +270,10 @@ Thread::run()
 		{
 			benchmark << "Linear";
 		}
+		else if (rl::plan::VectorizedLinearNearestNeighbors* vectorizedLinearNearestNeighbors = dynamic_cast<rl::plan::VectorizedLinearNearestNeighbors*>(MainWindow::instance()->nearestNeighbors.front().get()))
+		{
+			benchmark << "VectorizedLinear";
+		}
 	}
 	
 	benchmark << ",";
@@ -0,0 +1,381 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_MATH_CONCURRENTNEARESTNEIGHBORS_H
+#define RL_MATH_CONCURRENTNEARESTNEIGHBORS_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace rl
+{
+	namespace math
+	{
+		/**
+		 * Nearest neighbor search supporting concurrent insertion and queries.
+		 * 
+		 * Values are appended to a buffer of chunks that never move, so that
+		 * queries can read them without locking. A static instance of
+		 * NearestNeighborsT is rebuilt from all values once the buffer
+		 * contains more values than the rebuild threshold and the rebuild
+		 * factor times the size of the current instance, and then published
+		 * atomically. Rebuilds thereby occur at geometrically growing sizes,
+		 * keeping the total cost of insertion at O(n log n) for tree-based
+		 * NearestNeighborsT. Queries combine the results of the most
+		 * recently published instance with a linear search over the values
+		 * appended after it.
+		 * 
+		 * Concurrent calls to push() and nearest() or radius() are safe,
+		 * clear() and swap() require exclusive access. A value is visible to
+		 * all queries started after the corresponding push() returned.
+		 */
+		template<typename NearestNeighborsT>
+		class ConcurrentNearestNeighbors
+		{
+		public:
+			typedef typename NearestNeighborsT::const_reference const_reference;
+			
+			typedef typename NearestNeighborsT::difference_type difference_type;
+			
+			typedef typename NearestNeighborsT::reference reference;
+			
+			typedef typename NearestNeighborsT::size_type size_type;
+			
+			typedef typename NearestNeighborsT::value_type value_type;
+			
+			typedef typename NearestNeighborsT::Distance Distance;
+			
+			typedef typename NearestNeighborsT::Metric Metric;
+			
+			typedef typename NearestNeighborsT::Neighbor Neighbor;
+			
+			typedef NearestNeighborsT NearestNeighbors;
+			
+			typedef typename NearestNeighborsT::Value Value;
+			
+			explicit ConcurrentNearestNeighbors(const Metric& metric) :
+				chunks(),
+				count(0),
+				factor(0.5),
+				metric(metric),
+				mutex(),
+				rebuilding(false),
+				snapshot(::std::make_shared<Snapshot>(metric)),
+				threshold(256)
+			{
+				this->initialize();
+			}
+			
+			explicit ConcurrentNearestNeighbors(Metric&& metric = Metric()) :
+				chunks(),
+				count(0),
+				factor(0.5),
+				metric(::std::move(metric)),
+				mutex(),
+				rebuilding(false),
+				snapshot(::std::make_shared<Snapshot>(this->metric)),
+				threshold(256)
+			{
+				this->initialize();
+			}
+			
+			~ConcurrentNearestNeighbors()
+			{
+				for (::std::size_t i = 0; i < this->chunks.size(); ++i)
+				{
+					delete[] this->chunks[i].load(::std::memory_order_relaxed);
+				}
+			}
+			
+			void clear()
+			{
+				for (::std::size_t i = 0; i < this->chunks.size(); ++i)
+				{
+					delete[] this->chunks[i].exchange(nullptr, ::std::memory_order_relaxed);
+				}
+				
+				this->count.store(0, ::std::memory_order_release);
+				::std::atomic_store(&this->snapshot, ::std::shared_ptr<const Snapshot>(::std::make_shared<Snapshot>(this->metric)));
+			}
+			
+			::std::vector<Value> data() const
+			{
+				::std::size_t count = this->count.load(::std::memory_order_acquire);
+				
+				::std::vector<Value> data;
+				data.reserve(count);
+				
+				for (::std::size_t i = 0; i < count; ++i)
+				{
+					data.push_back(this->at(i));
+				}
+				
+				return data;
+			}
+			
+			bool empty() const
+			{
+				return 0 == this->size();
+			}
+			
+			double getRebuildFactor() const
+			{
+				return this->factor;
+			}
+			
+			::std::size_t getRebuildThreshold() const
+			{
+				return this->threshold;
+			}
+			
+			template<typename InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{
+				for (InputIterator i = first; i != last; ++i)
+				{
+					this->push(*i);
+				}
+			}
+			
+			::std::vector<Neighbor> nearest(const Value& query, const ::std::size_t& k, const bool& sorted = true) const
+			{
+				return this->search(query, &k, nullptr, sorted);
+			}
+			
+			void push(const Value& value)
+			{
+				::std::size_t count;
+				
+				{
+					::std::lock_guard< ::std::mutex> lock(this->mutex);
+					
+					count = this->count.load(::std::memory_order_relaxed);
+					
+					::std::size_t chunk = ChunkOf(count);
+					
+					if (nullptr == this->chunks[chunk].load(::std::memory_order_relaxed))
+					{
+						this->chunks[chunk].store(new Value[ChunkSize(chunk)], ::std::memory_order_relaxed);
+					}
+					
+					this->chunks[chunk].load(::std::memory_order_relaxed)[count - ChunkBegin(chunk)] = value;
+					
+					this->count.store(++count, ::std::memory_order_release);
+				}
+				
+				::std::size_t size = ::std::atomic_load(&this->snapshot)->size;
+				
+				if (count - size >= ::std::max(this->threshold, static_cast< ::std::size_t>(this->factor * size)) && !this->rebuilding.exchange(true, ::std::memory_order_acquire))
+				{
+					this->rebuild();
+					this->rebuilding.store(false, ::std::memory_order_release);
+				}
+			}
+			
+			::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const
+			{
+				return this->search(query, nullptr, &radius, sorted);
+			}
+			
+			/**
+			 * Set minimum ratio of buffered values to values of the current
+			 * instance that triggers a rebuild.
+			 * 
+			 * Larger values reduce the number of rebuilds, smaller values
+			 * reduce the length of the linear search over buffered values.
+			 */
+			void setRebuildFactor(const double& factor)
+			{
+				this->factor = ::std::max(factor, 0.0);
+			}
+			
+			/**
+			 * Set minimum number of buffered values that triggers a rebuild.
+			 * 
+			 * Rebuilds are performed by the thread whose push() exceeded the
+			 * threshold, while other threads continue to insert and query.
+			 */
+			void setRebuildThreshold(const ::std::size_t& threshold)
+			{
+				this->threshold = ::std::max< ::std::size_t>(threshold, 1);
+			}
+			
+			::std::size_t size() const
+			{
+				return this->count.load(::std::memory_order_acquire);
+			}
+			
+		protected:
+			
+		private:
+			enum
+			{
+				FirstChunkSize = 64
+			};
+			
+			struct NeighborCompare
+			{
+				bool operator()(const Neighbor& lhs, const Neighbor& rhs) const
+				{
+					return lhs.first < rhs.first;
+				}
+			};
+			
+			struct Snapshot
+			{
+				explicit Snapshot(const Metric& metric) :
+					nearestNeighbors(metric),
+					size(0)
+				{
+				}
+				
+				template<typename InputIterator>
+				Snapshot(InputIterator first, InputIterator last, const Metric& metric) :
+					nearestNeighbors(first, last, metric),
+					size(::std::distance(first, last))
+				{
+				}
+				
+				NearestNeighbors nearestNeighbors;
+				
+				::std::size_t size;
+			};
+			
+			/** Start index of chunk, chunk i holds FirstChunkSize * 2^i values. */
+			static ::std::size_t ChunkBegin(const ::std::size_t& chunk)
+			{
+				return FirstChunkSize * ((static_cast< ::std::size_t>(1) << chunk) - 1);
+			}
+			
+			static ::std::size_t ChunkOf(const ::std::size_t& index)
+			{
+				::std::size_t n = index / FirstChunkSize + 1;
+				::std::size_t chunk = 0;
+				
+				while (n >>= 1)
+				{
+					++chunk;
+				}
+				
+				return chunk;
+			}
+			
+			static ::std::size_t ChunkSize(const ::std::size_t& chunk)
+			{
+				return FirstChunkSize * (static_cast< ::std::size_t>(1) << chunk);
+			}
+			
+			const Value& at(const ::std::size_t& index) const
+			{
+				::std::size_t chunk = ChunkOf(index);
+				return this->chunks[chunk].load(::std::memory_order_relaxed)[index - ChunkBegin(chunk)];
+			}
+			
+			void initialize()
+			{
+				for (::std::size_t i = 0; i < this->chunks.size(); ++i)
+				{
+					this->chunks[i].store(nullptr, ::std::memory_order_relaxed);
+				}
+			}
+			
+			void rebuild()
+			{
+				::std::vector<Value> data = this->data();
+				::std::atomic_store(&this->snapshot, ::std::shared_ptr<const Snapshot>(::std::make_shared<Snapshot>(data.begin(), data.end(), this->metric)));
+			}
+			
+			::std::vector<Neighbor> search(const Value& query, const ::std::size_t* k, const Distance* radius, const bool& sorted) const
+			{
+				::std::shared_ptr<const Snapshot> snapshot = ::std::atomic_load(&this->snapshot);
+				::std::size_t count = this->count.load(::std::memory_order_acquire);
+				
+				::std::vector<Neighbor> neighbors;
+				
+				if (!snapshot->nearestNeighbors.empty())
+				{
+					neighbors = nullptr != k ? snapshot->nearestNeighbors.nearest(query, *k, false) : snapshot->nearestNeighbors.radius(query, *radius, false);
+				}
+				
+				::std::make_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+				
+				for (::std::size_t i = snapshot->size; i < count; ++i)
+				{
+					Distance distance = this->metric(query, this->at(i));
+					
+					if (nullptr == k || neighbors.size() < *k || distance < neighbors.front().first)
+					{
+						if (nullptr == radius || distance < *radius)
+						{
+							if (nullptr != k && *k == neighbors.size())
+							{
+								::std::pop_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+								neighbors.pop_back();
+							}
+							
+#if defined(_MSC_VER) && _MSC_VER < 1800
+							neighbors.push_back(::std::make_pair(distance, this->at(i)));
+#else
+							neighbors.emplace_back(::std::piecewise_construct, ::std::forward_as_tuple(distance), ::std::forward_as_tuple(this->at(i)));
+#endif
+							::std::push_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+						}
+					}
+				}
+				
+				if (sorted)
+				{
+					::std::sort_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+				}
+				
+				return neighbors;
+			}
+			
+			::std::array< ::std::atomic<Value*>, 48> chunks;
+			
+			::std::atomic< ::std::size_t> count;
+			
+			double factor;
+			
+			Metric metric;
+			
+			::std::mutex mutex;
+			
+			::std::atomic<bool> rebuilding;
+			
+			::std::shared_ptr<const Snapshot> snapshot;
+			
+			::std::size_t threshold;
+		};
+	}
+}
+
+#endif // RL_MATH_CONCURRENTNEARESTNEIGHBORS_H
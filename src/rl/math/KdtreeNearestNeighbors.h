@@ -31,7 +31,6 @@
 #include <array>
 #include <cmath>
 #include <iterator>
-#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <utility>
@@ -50,6 +49,16 @@ namespace rl
 		 * September 1975.
 		 * 
 		 * http://dx.doi.org/10.1145/361002.361007
+		 * 
+		 * Nodes are stored contiguously in a single container and refer to
+		 * their children by index, values are stored inside the leaf nodes.
+		 * 
+		 * Subtrees that become unbalanced during incremental insertion are
+		 * rebuilt, as in scapegoat trees.
+		 * 
+		 * Igal Galperin and Ronald L. Rivest. Scapegoat trees. In Proceedings
+		 * of the ACM-SIAM Symposium on Discrete Algorithms, pages 165-174,
+		 * January 1993.
 		 */
 		template<typename MetricT>
 		class KdtreeNearestNeighbors
@@ -79,10 +88,11 @@ namespace rl
 			typedef ::std::pair<Distance, Value> Neighbor;
 			
 			explicit KdtreeNearestNeighbors(const Metric& metric) :
+				balance(0.75),
 				checks(),
 				mean(),
 				metric(metric),
-				root(),
+				nodes(1),
 				samples(100),
 				values(0),
 				var()
@@ -90,10 +100,11 @@ namespace rl
 			}
 			
 			explicit KdtreeNearestNeighbors(Metric&& metric = Metric()) :
+				balance(0.75),
 				checks(),
 				mean(),
 				metric(::std::move(metric)),
-				root(),
+				nodes(1),
 				samples(100),
 				values(0),
 				var()
@@ -102,10 +113,11 @@ namespace rl
 			
 			template<typename InputIterator>
 			KdtreeNearestNeighbors(InputIterator first, InputIterator last, const Metric& metric) :
+				balance(0.75),
 				checks(),
 				mean(),
 				metric(metric),
-				root(),
+				nodes(1),
 				samples(100),
 				values(0),
 				var()
@@ -115,10 +127,11 @@ namespace rl
 			
 			template<typename InputIterator>
 			KdtreeNearestNeighbors(InputIterator first, InputIterator last, Metric&& metric = Metric()) :
+				balance(0.75),
 				checks(),
 				mean(),
 				metric(::std::move(metric)),
-				root(),
+				nodes(1),
 				samples(100),
 				values(0),
 				var()
@@ -132,9 +145,7 @@ namespace rl
 			
 			void clear()
 			{
-				this->root.children[0].reset(nullptr);
-				this->root.children[1].reset(nullptr);
-				this->root.data.reset();
+				this->nodes.assign(1, Node());
 				this->values = 0;
 			}
 			
@@ -142,13 +153,53 @@ namespace rl
 			{
 				::std::vector<Value> data;
 				data.reserve(this->values);
-				this->data(this->root, data);
+				
+				for (::std::size_t i = 0; i < this->nodes.size(); ++i)
+				{
+					if (this->nodes[i].data)
+					{
+						data.push_back(*this->nodes[i].data);
+					}
+				}
+				
 				return data;
 			}
 			
 			bool empty() const
 			{
-				return !this->root.data && nullptr == this->root.children[0] && nullptr == this->root.children[1];
+				return !this->nodes.front().data && this->nodes.front().isLeaf();
+			}
+			
+			/**
+			 * Compute maximum depth of leaf nodes.
+			 */
+			::std::size_t depth() const
+			{
+				::std::size_t depth = 0;
+				::std::vector< ::std::pair< ::std::size_t, ::std::size_t>> stack(1, ::std::make_pair(0, 0));
+				
+				while (!stack.empty())
+				{
+					::std::pair< ::std::size_t, ::std::size_t> node = stack.back();
+					stack.pop_back();
+					
+					if (this->nodes[node.first].isLeaf())
+					{
+						depth = ::std::max(depth, node.second);
+					}
+					else
+					{
+						stack.push_back(::std::make_pair(this->nodes[node.first].children[0], node.second + 1));
+						stack.push_back(::std::make_pair(this->nodes[node.first].children[1], node.second + 1));
+					}
+				}
+				
+				return depth;
+			}
+			
+			::boost::optional<double> getBalance() const
+			{
+				return this->balance;
 			}
 			
 			::boost::optional< ::std::size_t> getChecks() const
@@ -170,11 +221,13 @@ namespace rl
 					
 					if (size > 1)
 					{
-						this->divide(this->root, first, last);
+						this->nodes.reserve(2 * size - 1);
+						this->divide(0, first, last, nullptr);
 					}
-					else
+					else if (size > 0)
 					{
-						this->root.data = *first;
+						this->nodes.front().data = *first;
+						this->nodes.front().size = 1;
 					}
 					
 					this->values += ::std::distance(first, last);
@@ -195,8 +248,73 @@ namespace rl
 			
 			void push(const Value& value)
 			{
-				this->push(this->root, value);
+				using ::std::begin;
+				using ::std::size;
+				
+				::std::size_t node = 0;
+				::boost::optional< ::std::size_t> scapegoat;
+				
+				while (!this->nodes[node].isLeaf())
+				{
+					::std::size_t child = this->nodes[node].children[*(begin(value) + this->nodes[node].cut.index) < this->nodes[node].cut.value ? 0 : 1];
+					++this->nodes[node].size;
+					
+					if (this->balance && !scapegoat && this->nodes[node].size > RebuildSize && this->nodes[child].size + 1 > *this->balance * this->nodes[node].size)
+					{
+						scapegoat = node;
+					}
+					
+					node = child;
+				}
+				
+				++this->nodes[node].size;
+				
+				if (!this->nodes[node].data)
+				{
+					this->nodes[node].data = value;
+				}
+				else
+				{
+					::std::size_t dim = size(value);
+					Cut cut;
+					cut.index = 0;
+					Distance max = Distance();
+					
+					for (::std::size_t i = 0; i < dim; ++i)
+					{
+						Distance span = ::std::abs(*(begin(value) + i) - *(begin(*this->nodes[node].data) + i));
+						
+						if (span > max)
+						{
+							max = span;
+							cut.index = i;
+						}
+					}
+					
+					bool less = *(begin(value) + cut.index) < *(begin(*this->nodes[node].data) + cut.index);
+					cut.value = (*(begin(value) + cut.index) + *(begin(*this->nodes[node].data) + cut.index)) / 2;
+					
+					::std::size_t children = this->nodes.size();
+					this->nodes.push_back(Node());
+					this->nodes.push_back(Node());
+					
+					this->nodes[children + (less ? 0 : 1)].data = value;
+					this->nodes[children + (less ? 0 : 1)].size = 1;
+					this->nodes[children + (less ? 1 : 0)].data = ::std::move(this->nodes[node].data);
+					this->nodes[children + (less ? 1 : 0)].size = 1;
+					
+					this->nodes[node].children[0] = children;
+					this->nodes[node].children[1] = children + 1;
+					this->nodes[node].cut = cut;
+					this->nodes[node].data.reset();
+				}
+				
 				++this->values;
+				
+				if (scapegoat)
+				{
+					this->rebuild(*scapegoat);
+				}
 			}
 			
 			::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const
@@ -204,6 +322,18 @@ namespace rl
 				return this->search(query, nullptr, &radius, sorted);
 			}
 			
+			/**
+			 * Set maximum fraction of values in one child of a subtree.
+			 * 
+			 * Subtrees with a child exceeding this fraction after insertion
+			 * of a value are rebuilt, values in [0.5, 1] trade query time
+			 * against insertion time. No value disables rebuilding.
+			 */
+			void setBalance(const ::boost::optional<double>& balance)
+			{
+				this->balance = balance;
+			}
+			
 			void setChecks(const ::boost::optional< ::std::size_t>& checks)
 			{
 				this->checks = checks;
@@ -222,10 +352,12 @@ namespace rl
 			void swap(KdtreeNearestNeighbors& other)
 			{
 				using ::std::swap;
+				swap(this->balance, other.balance);
+				swap(this->checks, other.checks);
 				swap(this->mean, other.mean);
 				swap(this->metric, other.metric);
+				swap(this->nodes, other.nodes);
 				swap(this->samples, other.samples);
-				swap(this->root, other.root);
 				swap(this->values, other.values);
 				swap(this->var, other.var);
 			}
@@ -238,16 +370,22 @@ namespace rl
 		protected:
 			
 		private:
+			enum
+			{
+				/** Minimum number of values in subtrees that are rebuilt. */
+				RebuildSize = 16
+			};
+			
 			struct Branch
 			{
-				Branch(Distance& dist, ::std::vector<Distance>& sidedist, const Node* node) :
+				Branch(Distance& dist, ::std::vector<Distance>& sidedist, const ::std::size_t& node) :
 					dist(dist),
 					node(node),
 					sidedist(sidedist)
 				{
 				}
 				
-				Branch(Distance& dist, ::std::vector<Distance>&& sidedist, const Node* node) :
+				Branch(Distance& dist, ::std::vector<Distance>&& sidedist, const ::std::size_t& node) :
 					dist(dist),
 					node(node),
 					sidedist(::std::move(sidedist))
@@ -256,7 +394,7 @@ namespace rl
 				
 				Distance dist;
 				
-				const Node* node;
+				::std::size_t node;
 				
 				::std::vector<Distance> sidedist;
 			};
@@ -295,7 +433,8 @@ namespace rl
 				Node() :
 					children(),
 					cut(),
-					data()
+					data(),
+					size(0)
 				{
 				}
 				
@@ -303,119 +442,126 @@ namespace rl
 				{
 				}
 				
-				void swap(Node& other)
-				{
-					using ::std::swap;
-					swap(this->children, other.children);
-					swap(this->cut, other.cut);
-					swap(this->data, other.data);
-				}
-				
-				friend void swap(Node& lhs, Node& rhs)
+				bool isLeaf() const
 				{
-					lhs.swap(rhs);
+					return 0 == this->children[0];
 				}
 				
-				::std::array< ::std::unique_ptr<Node>, 2> children;
+				/** Indices of children, zero for leaf nodes. */
+				::std::array< ::std::size_t, 2> children;
 				
 				Cut cut;
 				
 				::boost::optional<Value> data;
+				
+				/** Number of values in subtree. */
+				::std::size_t size;
 			};
 			
-			void data(const Node& node, ::std::vector<Value>& data) const
+			struct CutCompare
 			{
-				data.push_back(*node.data);
+				bool operator()(const Value& lhs, const Value& rhs) const
+				{
+					using ::std::begin;
+					return *(begin(lhs) + this->index) < *(begin(rhs) + this->index);
+				}
 				
-				for (::std::size_t i = 0; i < node.children.size(); ++i)
+				Size index;
+			};
+			
+			::std::size_t allocate(::std::vector< ::std::size_t>* free)
+			{
+				if (nullptr != free && !free->empty())
 				{
-					this->data(*node.children[i], data);
+					::std::size_t node = free->back();
+					free->pop_back();
+					this->nodes[node] = Node();
+					return node;
 				}
+				
+				this->nodes.push_back(Node());
+				return this->nodes.size() - 1;
 			}
 			
+			/**
+			 * Build subtree from values, reusing nodes in free if available.
+			 * 
+			 * Splits at the mean of the dimension with the largest variance,
+			 * or at the median if this does not respect the balance.
+			 */
 			template<typename InputIterator>
-			void divide(Node& node, InputIterator first, InputIterator last)
+			void divide(const ::std::size_t& node, InputIterator first, InputIterator last, ::std::vector< ::std::size_t>* free)
 			{
-				node.cut = this->select(first, last);
-				InputIterator split = ::std::partition(first, last, node.cut);
+				using ::std::begin;
+				
+				::std::size_t size = ::std::distance(first, last);
+				
+				this->nodes[node].cut = this->select(first, last);
+				InputIterator split = ::std::partition(first, last, this->nodes[node].cut);
+				::std::size_t larger = ::std::max(::std::distance(first, split), ::std::distance(split, last));
+				
+				if (split == first || split == last || (this->balance && larger > *this->balance * size))
+				{
+					CutCompare compare;
+					compare.index = this->nodes[node].cut.index;
+					split = first + size / 2;
+					::std::nth_element(first, split, last, compare);
+					this->nodes[node].cut.value = *(begin(*split) + compare.index);
+				}
+				
+				this->nodes[node].size = size;
 				
 				for (::std::size_t i = 0; i < 2; ++i)
 				{
-#if __cplusplus > 201103L || _MSC_VER >= 1800
-					node.children[i] = ::std::make_unique<Node>();
-#else
-					node.children[i].reset(new Node());
-#endif
+					::std::size_t child = this->allocate(free);
+					this->nodes[node].children[i] = child;
 					
 					InputIterator begin = 0 == i ? first : split;
 					InputIterator end = 0 == i ? split : last;
 					
 					if (::std::distance(begin, end) > 1)
 					{
-						this->divide(*node.children[i], begin, end);
+						this->divide(child, begin, end, free);
 					}
 					else
 					{
-						node.children[i]->data = *begin;
+						this->nodes[child].data = *begin;
+						this->nodes[child].size = 1;
 					}
 				}
 			}
 			
-			void push(Node& node, const Value& value)
+			void rebuild(const ::std::size_t& node)
 			{
-				using ::std::begin;
-				using ::std::size;
+				::std::vector<Value> data;
+				data.reserve(this->nodes[node].size);
+				::std::vector< ::std::size_t> free;
+				free.reserve(2 * this->nodes[node].size);
+				::std::vector< ::std::size_t> stack(1, node);
 				
-				if (nullptr == node.children[0] && nullptr == node.children[1] && !node.data)
+				while (!stack.empty())
 				{
-					node.data = value;
-				}
-				else if (nullptr == node.children[0] && nullptr == node.children[1])
-				{
-					::std::size_t dim = size(value);
-					Distance max = Distance();
+					::std::size_t index = stack.back();
+					stack.pop_back();
 					
-					for (::std::size_t i = 0; i < dim; ++i)
+					if (this->nodes[index].isLeaf())
 					{
-						Distance span = ::std::abs(*(begin(value) + i) - *(begin(*node.data) + i));
-						
-						if (span > max)
-						{
-							max = span;
-							node.cut.index = i;
-						}
+						data.push_back(::std::move(*this->nodes[index].data));
 					}
-					
-					for (::std::size_t i = 0; i < 2; ++i)
+					else
 					{
-#if __cplusplus > 201103L || _MSC_VER >= 1800
-						node.children[i] = ::std::make_unique<Node>();
-#else
-						node.children[i].reset(new Node());
-#endif
+						stack.push_back(this->nodes[index].children[0]);
+						stack.push_back(this->nodes[index].children[1]);
 					}
 					
-					bool less = *(begin(value) + node.cut.index) < *(begin(*node.data) + node.cut.index);
-					node.cut.value = (*(begin(value) + node.cut.index) + *(begin(*node.data) + node.cut.index)) / 2;
-					
-					node.children[0]->cut.index = 0;
-					node.children[0]->data = less ? value : ::std::move(node.data);
-					node.children[1]->cut.index = 0;
-					node.children[1]->data = less ? ::std::move(node.data) : value;
-					
-					node.data.reset();
-				}
-				else
-				{
-					if (*(begin(value) + node.cut.index) < node.cut.value)
-					{
-						this->push(*node.children[0], value);
-					}
-					else
+					if (index != node)
 					{
-						this->push(*node.children[1], value);
+						free.push_back(index);
 					}
 				}
+				
+				this->nodes[node] = Node();
+				this->divide(node, data.begin(), data.end(), &free);
 			}
 			
 			::std::vector<Neighbor> search(const Value& query, const ::std::size_t* k, const Distance* radius, const bool& sorted) const
@@ -438,14 +584,14 @@ namespace rl
 				
 				::std::vector<Branch> branches;
 				::std::vector<Distance> sidedist(size(query), Distance());
-				this->search(this->root, query, k, radius, branches, neighbors, checks, Distance(), sidedist);
+				this->search(0, query, k, radius, branches, neighbors, checks, Distance(), sidedist);
 				
 				while (!branches.empty() && (!this->checks || checks < this->checks))
 				{
 					Branch branch = ::std::move(branches.front());
 					::std::pop_heap(branches.begin(), branches.end(), BranchCompare());
 					branches.pop_back();
-					this->search(*branch.node, query, k, radius, branches, neighbors, checks, branch.dist, branch.sidedist);
+					this->search(branch.node, query, k, radius, branches, neighbors, checks, branch.dist, branch.sidedist);
 				}
 				
 				if (sorted)
@@ -456,11 +602,13 @@ namespace rl
 				return neighbors;
 			}
 			
-			void search(const Node& node, const Value& query, const ::std::size_t* k, const Distance* radius, ::std::vector<Branch>& branches, ::std::vector<Neighbor>& neighbors, ::std::size_t& checks, const Distance& mindist, ::std::vector<Distance>& sidedist) const
+			void search(const ::std::size_t& index, const Value& query, const ::std::size_t* k, const Distance* radius, ::std::vector<Branch>& branches, ::std::vector<Neighbor>& neighbors, ::std::size_t& checks, const Distance& mindist, ::std::vector<Distance>& sidedist) const
 			{
 				using ::std::begin;
 				
-				if (nullptr == node.children[0] && nullptr == node.children[1])
+				const Node& node = this->nodes[index];
+				
+				if (node.isLeaf())
 				{
 					if (node.data)
 					{
@@ -496,7 +644,7 @@ namespace rl
 					::std::size_t best = diff < 0 ? 0 : 1;
 					::std::size_t worst = diff < 0 ? 1 : 0;
 					
-					this->search(*node.children[best], query, k, radius, branches, neighbors, checks, mindist, sidedist);
+					this->search(node.children[best], query, k, radius, branches, neighbors, checks, mindist, sidedist);
 					
 					Distance cutdist = this->metric(value, node.cut.value, node.cut.index);
 					Distance newdist = mindist - sidedist[node.cut.index] + cutdist;
@@ -507,7 +655,7 @@ namespace rl
 						{
 							Distance dist = sidedist[node.cut.index];
 							sidedist[node.cut.index] = cutdist;
-							this->search(*node.children[worst], query, k, radius, branches, neighbors, checks, newdist, sidedist);
+							this->search(node.children[worst], query, k, radius, branches, neighbors, checks, newdist, sidedist);
 							sidedist[node.cut.index] = dist;
 						}
 						else
@@ -515,9 +663,9 @@ namespace rl
 							::std::vector<Distance> newsidedist(sidedist);
 							newsidedist[node.cut.index] = cutdist;
 #if defined(_MSC_VER) && _MSC_VER < 1800
-							branches.push_back(Branch(newdist, ::std::move(newsidedist), node.children[worst].get()));
+							branches.push_back(Branch(newdist, ::std::move(newsidedist), node.children[worst]));
 #else
-							branches.emplace_back(newdist, ::std::move(newsidedist), node.children[worst].get());
+							branches.emplace_back(newdist, ::std::move(newsidedist), node.children[worst]);
 #endif
 							::std::push_heap(branches.begin(), branches.end(), BranchCompare());
 						}
@@ -572,13 +720,15 @@ namespace rl
 				return cut;
 			}
 			
+			::boost::optional<double> balance;
+			
 			::boost::optional< ::std::size_t> checks;
 			
 			::std::vector<Distance> mean;
 			
 			Metric metric;
 			
-			Node root;
+			::std::vector<Node> nodes;
 			
 			::std::size_t samples;
 			
@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_MATH_VECTORIZEDLINEARNEARESTNEIGHBORS_H
+#define RL_MATH_VECTORIZEDLINEARNEARESTNEIGHBORS_H
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <Eigen/Core>
+
+#include "Real.h"
+
+namespace rl
+{
+	namespace math
+	{
+		/**
+		 * Linear nearest neighbor search on coordinates stored in blocks.
+		 * 
+		 * Coordinates of values are copied into blocks of BlockSize values,
+		 * with all coordinates of one dimension stored contiguously, so that
+		 * distances to a whole block are evaluated with vectorized array
+		 * operations.
+		 * 
+		 * Distances are squared Euclidean distances. Dimensions with a
+		 * positive range wrap around, i.e., the difference of a coordinate is
+		 * the minimum of its absolute value and the remainder of the range,
+		 * as in the transformed distance of revolute joints.
+		 */
+		template<typename ValueT, typename DistanceT = Real>
+		class VectorizedLinearNearestNeighbors
+		{
+		public:
+			enum
+			{
+				BlockSize = 64
+			};
+			
+			typedef const ValueT& const_reference;
+			
+			typedef ::std::ptrdiff_t difference_type;
+			
+			typedef ValueT& reference;
+			
+			typedef ::std::size_t size_type;
+			
+			typedef ValueT value_type;
+			
+			typedef DistanceT Distance;
+			
+			typedef ValueT Value;
+			
+			typedef ::std::pair<Distance, Value> Neighbor;
+			
+			typedef ::Eigen::Array<Distance, ::Eigen::Dynamic, 1> Ranges;
+			
+			VectorizedLinearNearestNeighbors() :
+				blocks(),
+				ranges(),
+				values()
+			{
+			}
+			
+			explicit VectorizedLinearNearestNeighbors(const Ranges& ranges) :
+				blocks(),
+				ranges(ranges),
+				values()
+			{
+			}
+			
+			template<typename InputIterator>
+			VectorizedLinearNearestNeighbors(InputIterator first, InputIterator last, const Ranges& ranges = Ranges()) :
+				blocks(),
+				ranges(ranges),
+				values()
+			{
+				this->insert(first, last);
+			}
+			
+			~VectorizedLinearNearestNeighbors()
+			{
+			}
+			
+			void clear()
+			{
+				this->blocks.clear();
+				this->values.clear();
+			}
+			
+			::std::vector<Value> data() const
+			{
+				return this->values;
+			}
+			
+			bool empty() const
+			{
+				return this->values.empty();
+			}
+			
+			const Ranges& getRanges() const
+			{
+				return this->ranges;
+			}
+			
+			template<typename InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{
+				for (InputIterator i = first; i != last; ++i)
+				{
+					this->push(*i);
+				}
+			}
+			
+			::std::vector<Neighbor> nearest(const Value& query, const ::std::size_t& k, const bool& sorted = true) const
+			{
+				return this->search(query, &k, nullptr, sorted);
+			}
+			
+			void push(const Value& value)
+			{
+				using ::std::begin;
+				using ::std::size;
+				
+				::std::size_t row = this->values.size() % BlockSize;
+				
+				if (0 == row)
+				{
+					this->blocks.push_back(Block::Zero(BlockSize, size(value)));
+				}
+				
+				for (::std::size_t i = 0; i < static_cast< ::std::size_t>(this->blocks.back().cols()); ++i)
+				{
+					this->blocks.back()(row, i) = *(begin(value) + i);
+				}
+				
+				this->values.push_back(value);
+			}
+			
+			::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const
+			{
+				return this->search(query, nullptr, &radius, sorted);
+			}
+			
+			void reserve(const ::std::size_t& capacity)
+			{
+				this->blocks.reserve((capacity + BlockSize - 1) / BlockSize);
+				this->values.reserve(capacity);
+			}
+			
+			/**
+			 * Set ranges of dimensions that wrap around.
+			 * 
+			 * @param[in] ranges Range per dimension, zero for no wraparound
+			 */
+			void setRanges(const Ranges& ranges)
+			{
+				this->ranges = ranges;
+			}
+			
+			::std::size_t size() const
+			{
+				return this->values.size();
+			}
+			
+			void swap(VectorizedLinearNearestNeighbors& other)
+			{
+				using ::std::swap;
+				swap(this->blocks, other.blocks);
+				swap(this->ranges, other.ranges);
+				swap(this->values, other.values);
+			}
+			
+			friend void swap(VectorizedLinearNearestNeighbors& lhs, VectorizedLinearNearestNeighbors& rhs)
+			{
+				lhs.swap(rhs);
+			}
+			
+		protected:
+			
+		private:
+			typedef ::Eigen::Array<Distance, BlockSize, ::Eigen::Dynamic> Block;
+			
+			struct NeighborCompare
+			{
+				bool operator()(const Neighbor& lhs, const Neighbor& rhs) const
+				{
+					return lhs.first < rhs.first;
+				}
+			};
+			
+			::std::vector<Neighbor> search(const Value& query, const ::std::size_t* k, const Distance* radius, const bool& sorted) const
+			{
+				using ::std::begin;
+				
+				::std::vector<Neighbor> neighbors;
+				
+				if (this->empty())
+				{
+					return neighbors;
+				}
+				
+				if (nullptr != k)
+				{
+					neighbors.reserve(::std::min(*k, this->size()));
+				}
+				
+				::std::size_t dim = this->blocks.front().cols();
+				
+				for (::std::size_t i = 0; i < this->blocks.size(); ++i)
+				{
+					::Eigen::Array<Distance, BlockSize, 1> distances = ::Eigen::Array<Distance, BlockSize, 1>::Zero();
+					
+					for (::std::size_t j = 0; j < dim; ++j)
+					{
+						::Eigen::Array<Distance, BlockSize, 1> delta = (this->blocks[i].col(j) - *(begin(query) + j)).abs();
+						
+						if (static_cast< ::std::size_t>(this->ranges.size()) > j && this->ranges(j) > 0)
+						{
+							delta = delta.min(this->ranges(j) - delta);
+						}
+						
+						distances += delta.square();
+					}
+					
+					::std::size_t rows = ::std::min(static_cast< ::std::size_t>(BlockSize), this->values.size() - i * BlockSize);
+					
+					if (nullptr != k && neighbors.size() == *k && distances.head(rows).minCoeff() >= neighbors.front().first)
+					{
+						continue;
+					}
+					
+					for (::std::size_t j = 0; j < rows; ++j)
+					{
+						if (nullptr == k || neighbors.size() < *k || distances(j) < neighbors.front().first)
+						{
+							if (nullptr == radius || distances(j) < *radius)
+							{
+								if (nullptr != k && *k == neighbors.size())
+								{
+									::std::pop_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+									neighbors.pop_back();
+								}
+								
+#if defined(_MSC_VER) && _MSC_VER < 1800
+								neighbors.push_back(::std::make_pair(distances(j), this->values[i * BlockSize + j]));
+#else
+								neighbors.emplace_back(distances(j), this->values[i * BlockSize + j]);
+#endif
+								::std::push_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+							}
+						}
+					}
+				}
+				
+				if (sorted)
+				{
+					::std::sort_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
+				}
+				
+				return neighbors;
+			}
+			
+			::std::vector<Block> blocks;
+			
+			Ranges ranges;
+			
+			::std::vector<Value> values;
+		};
+	}
+}
+
+#endif // RL_MATH_VECTORIZEDLINEARNEARESTNEIGHBORS_H
@@ -25,6 +25,7 @@
 //
 
 #include <algorithm>
+#include <limits>
 #include <stack>
 #include <boost/graph/graphviz.hpp>
 #include <rl/math/Quaternion.h>
@@ -32,8 +33,10 @@
 #include <rl/math/Spatial.h>
 #include <rl/math/Unit.h>
 
+#include "Body.h"
 #include "Exception.h"
 #include "Dynamic.h"
+#include "Joint.h"
 #include "Prismatic.h"
 #include "Revolute.h"
 #include "World.h"
@@ -78,6 +81,23 @@ namespace rl
 			this->setWorldGravity(g);
 		}
 		
+		void
+		Dynamic::calculateForwardDynamicsDerivatives(Workspace& workspace, ::rl::math::Matrix& dqdddq, ::rl::math::Matrix& dqdddqd, ::rl::math::Matrix& dqdddtau) const
+		{
+			this->forwardDynamics(workspace);
+			
+			// M^-1
+			this->calculateMassMatrix(workspace, dqdddtau);
+			dqdddtau = dqdddtau.llt().solve(::rl::math::Matrix::Identity(this->getDof(), this->getDof()));
+			
+			this->calculateInverseDynamicsDerivatives(workspace, dqdddq, dqdddqd);
+			
+			// -M^-1 * dtau/dq
+			dqdddq = -dqdddtau * dqdddq;
+			// -M^-1 * dtau/dqd
+			dqdddqd = -dqdddtau * dqdddqd;
+		}
+		
 		void
 		Dynamic::calculateGravity()
 		{
@@ -96,6 +116,135 @@ namespace rl
 			G = this->getTorque();
 		}
 		
+		void
+		Dynamic::calculateGravity(Workspace& workspace, ::rl::math::Vector& G) const
+		{
+			::rl::math::Vector tmp = ::rl::math::Vector::Zero(this->getDof());
+			G.resize(this->getDof());
+			this->recursiveNewtonEuler(workspace, tmp, tmp, G);
+		}
+		
+		void
+		Dynamic::calculateGravity(Workspace& workspace, const ::rl::math::Matrix& q, ::rl::math::Matrix& G) const
+		{
+			::rl::math::Vector tmp = ::rl::math::Vector::Zero(this->getDof());
+			G.resize(this->getDof(), q.cols());
+			
+			for (::std::ptrdiff_t i = 0; i < q.cols(); ++i)
+			{
+				workspace.q = q.col(i);
+				this->forwardPosition(workspace);
+				this->recursiveNewtonEuler(workspace, tmp, tmp, G.col(i));
+			}
+		}
+		
+		void
+		Dynamic::calculateInverseDynamicsDerivatives(Workspace& workspace, ::rl::math::Matrix& dtaudq, ::rl::math::Matrix& dtaudqd) const
+		{
+			this->inverseDynamics(workspace);
+			
+			dtaudq.resize(this->getDof(), this->getDof());
+			dtaudqd.resize(this->getDof(), this->getDof());
+			
+			::rl::math::MotionVector a0 = ::rl::math::MotionVector::Zero();
+			a0.linear() = this->getWorldGravity();
+			
+			::std::vector< ::rl::math::MotionVector, ::Eigen::aligned_allocator< ::rl::math::MotionVector>> da(this->transforms.size());
+			::std::vector< ::rl::math::ForceVector, ::Eigen::aligned_allocator< ::rl::math::ForceVector>> df(this->transforms.size());
+			::std::vector< ::rl::math::MotionVector, ::Eigen::aligned_allocator< ::rl::math::MotionVector>> dv(this->transforms.size());
+			
+			for (::std::size_t j = 0; j < this->transforms.size(); ++j)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() == this->offsets[j])
+				{
+					continue;
+				}
+				
+				Joint* joint = static_cast<Joint*>(this->transforms[j]);
+				
+				for (::std::size_t k = 0; k < joint->getDof(); ++k)
+				{
+					::rl::math::MotionVector s(joint->S.col(k));
+					
+					for (::std::size_t position = 0; position < 2; ++position)
+					{
+						for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+						{
+							::std::size_t p = this->parents[i];
+							
+							if (::std::numeric_limits< ::std::size_t>::max() != p)
+							{
+								// X * dv
+								dv[i] = workspace.x[i] * dv[p];
+								// X * da
+								da[i] = workspace.x[i] * da[p];
+							}
+							else
+							{
+								dv[i].setZero();
+								da[i].setZero();
+							}
+							
+							if (i == j && position)
+							{
+								// dX/dq * v = -s x X * v
+								dv[i] = dv[i] - s.cross(workspace.x[i] * (::std::numeric_limits< ::std::size_t>::max() != p ? workspace.v[p] : ::rl::math::MotionVector::Zero()));
+								// dX/dq * a = -s x X * a
+								da[i] = da[i] - s.cross(workspace.x[i] * (::std::numeric_limits< ::std::size_t>::max() != p ? workspace.a[p] : a0));
+							}
+							else if (i == j)
+							{
+								// dvj/dqd = s
+								dv[i] = dv[i] + s;
+								// v x dvj/dqd
+								da[i] = da[i] + workspace.v[i].cross(s);
+							}
+							
+							if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+							{
+								Joint* current = static_cast<Joint*>(this->transforms[i]);
+								// dv x vj
+								da[i] = da[i] + dv[i].cross(::rl::math::MotionVector(::rl::math::Vector6(current->S * workspace.qd.segment(this->offsets[i], current->getDof()))));
+							}
+							
+							if (nullptr != this->successors[i])
+							{
+								Body* body = this->successors[i];
+								// I * da + dv x I * v + v x I * dv
+								df[i] = body->i * da[i] + dv[i].cross(body->i * workspace.v[i]) + workspace.v[i].cross(body->i * dv[i]);
+							}
+							else
+							{
+								df[i].setZero();
+							}
+						}
+						
+						for (::std::size_t i = this->transforms.size(); i-- > 0;)
+						{
+							if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+							{
+								Joint* current = static_cast<Joint*>(this->transforms[i]);
+								// S^T * df
+								(position ? dtaudq : dtaudqd).block(this->offsets[i], this->offsets[j] + k, current->getDof(), 1).noalias() = current->S.transpose() * df[i].matrix();
+							}
+							
+							if (::std::numeric_limits< ::std::size_t>::max() != this->parents[i])
+							{
+								// df + X^* * df
+								df[this->parents[i]] = df[this->parents[i]] + workspace.x[i] / df[i];
+								
+								if (i == j && position)
+								{
+									// dX^*/dq * f = X^* * (s x f)
+									df[this->parents[i]] = df[this->parents[i]] + workspace.x[i] / s.cross(workspace.f[i]);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+		
 		void
 		Dynamic::calculateMassMatrix()
 		{
@@ -105,27 +254,83 @@ namespace rl
 		void
 		Dynamic::calculateMassMatrix(::rl::math::Matrix& M)
 		{
-			::rl::math::Vector3 g = this->getWorldGravity();
+			this->compositeRigidBody(M);
+			M = M * this->gammaVelocity;
+		}
+		
+		void
+		Dynamic::calculateMassMatrix(Workspace& workspace, ::rl::math::Matrix& M) const
+		{
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				if (nullptr != this->successors[i])
+				{
+					workspace.iC[i] = this->successors[i]->i;
+				}
+				else
+				{
+					workspace.iC[i].setZero();
+				}
+			}
 			
-			::rl::math::Vector tmp = ::rl::math::Vector::Zero(this->getDof());
+			for (::std::size_t i = this->transforms.size(); i-- > 0;)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() != this->parents[i])
+				{
+					// I^c + X^* * I^c * X
+					workspace.iC[this->parents[i]] = workspace.iC[this->parents[i]] + workspace.x[i] / workspace.iC[i];
+				}
+			}
 			
-			this->setVelocity(tmp);
-			this->setWorldGravity(::rl::math::Vector3::Zero());
+			M.setZero(this->getDof(), this->getDof());
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
 			{
-				for (::std::size_t j = 0; j < this->getDof(); ++j)
+				if (::std::numeric_limits< ::std::size_t>::max() == this->offsets[i])
 				{
-					tmp(j) = i == j ? 1 : 0;
+					continue;
 				}
 				
-				this->setAcceleration(tmp);
-				this->inverseDynamics();
+				Joint* joint = static_cast<Joint*>(this->transforms[i]);
 				
-				M.col(i) = this->getTorque();
+				// I^c * S
+				::Eigen::Matrix< ::rl::math::Real, 6, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> F = workspace.iC[i].matrix() * joint->S;
+				
+				// S^T * F
+				M.block(this->offsets[i], this->offsets[i], joint->getDof(), joint->getDof()).noalias() = joint->S.transpose() * F;
+				
+				for (::std::size_t j = i; ::std::numeric_limits< ::std::size_t>::max() != this->parents[j];)
+				{
+					// X^* * F
+					F = workspace.x[j].inverseForce() * F;
+					
+					j = this->parents[j];
+					
+					if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[j])
+					{
+						Joint* parent = static_cast<Joint*>(this->transforms[j]);
+						
+						// S^T * F
+						M.block(this->offsets[j], this->offsets[i], parent->getDof(), joint->getDof()).noalias() = parent->S.transpose() * F;
+						M.block(this->offsets[i], this->offsets[j], joint->getDof(), parent->getDof()) = M.block(this->offsets[j], this->offsets[i], parent->getDof(), joint->getDof()).transpose();
+					}
+				}
 			}
+		}
+		
+		void
+		Dynamic::calculateMassMatrix(Workspace& workspace, const ::rl::math::Matrix& q, ::rl::math::Matrix& M) const
+		{
+			::rl::math::Matrix tmp(this->getDof(), this->getDof());
+			M.resize(this->getDof(), this->getDof() * q.cols());
 			
-			this->setWorldGravity(g);
+			for (::std::ptrdiff_t i = 0; i < q.cols(); ++i)
+			{
+				workspace.q = q.col(i);
+				this->forwardPosition(workspace);
+				this->calculateMassMatrix(workspace, tmp);
+				M.middleCols(i * this->getDof(), this->getDof()) = tmp;
+			}
 		}
 		
 		void
@@ -137,27 +342,34 @@ namespace rl
 		void
 		Dynamic::calculateMassMatrixInverse(::rl::math::Matrix& invM)
 		{
-			::rl::math::Vector3 g = this->getWorldGravity();
+			::rl::math::Matrix H(this->getDof(), this->getDof());
+			this->compositeRigidBody(H);
 			
-			::rl::math::Vector tmp = ::rl::math::Vector::Zero(this->getDof());
+			// H = L^T * L with L sharing the sparsity pattern of H
 			
-			this->setVelocity(tmp);
-			this->setWorldGravity(::rl::math::Vector3::Zero());
-			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::size_t k = this->getDof(); k-- > 0;)
 			{
-				for (::std::size_t j = 0; j < this->getDof(); ++j)
+				H(k, k) = ::std::sqrt(H(k, k));
+				
+				for (::std::size_t i = this->lambda[k]; i != ::std::numeric_limits< ::std::size_t>::max(); i = this->lambda[i])
 				{
-					tmp(j) = i == j ? 1 : 0;
+					H(k, i) /= H(k, k);
 				}
 				
-				this->setTorque(tmp);
-				this->forwardDynamics();
-				
-				invM.col(i) = this->getAcceleration();
+				for (::std::size_t i = this->lambda[k]; i != ::std::numeric_limits< ::std::size_t>::max(); i = this->lambda[i])
+				{
+					for (::std::size_t j = i; j != ::std::numeric_limits< ::std::size_t>::max(); j = this->lambda[j])
+					{
+						H(i, j) -= H(k, i) * H(k, j);
+					}
+				}
 			}
 			
-			this->setWorldGravity(g);
+			// L^-1
+			::rl::math::Matrix invL = H.triangularView< ::Eigen::Lower>().solve(::rl::math::Matrix::Identity(this->getDof(), this->getDof()));
+			
+			// Gamma^-1 * L^-1 * L^-T
+			invM = this->invGammaVelocity * invL * invL.transpose();
 		}
 		
 		void
@@ -172,22 +384,277 @@ namespace rl
 			invMx = J * invM * J.transpose();
 		}
 		
+		void
+		Dynamic::compositeRigidBody(::rl::math::Matrix& H)
+		{
+			for (::std::vector<Frame*>::iterator i = this->frames.begin(); i != this->frames.end(); ++i)
+			{
+				(*i)->iC.setZero();
+			}
+			
+			for (::std::vector<Body*>::iterator i = this->bodies.begin(); i != this->bodies.end(); ++i)
+			{
+				(*i)->iC = (*i)->i;
+			}
+			
+			for (::std::vector<Transform*>::reverse_iterator i = this->transforms.rbegin(); i != this->transforms.rend(); ++i)
+			{
+				// I^c + X^* * I^c * X
+				(*i)->in->iC = (*i)->in->iC + (*i)->x / (*i)->out->iC;
+			}
+			
+			H.setZero(this->getDof(), this->getDof());
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() == this->offsets[i])
+				{
+					continue;
+				}
+				
+				Joint* joint = static_cast<Joint*>(this->transforms[i]);
+				
+				// I^c * S
+				::Eigen::Matrix< ::rl::math::Real, 6, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> F = joint->out->iC.matrix() * joint->S;
+				
+				// S^T * F
+				H.block(this->offsets[i], this->offsets[i], joint->getDof(), joint->getDof()).noalias() = joint->S.transpose() * F;
+				
+				for (::std::size_t j = i; ::std::numeric_limits< ::std::size_t>::max() != this->parents[j];)
+				{
+					// X^* * F
+					F = this->transforms[j]->x.inverseForce() * F;
+					
+					j = this->parents[j];
+					
+					if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[j])
+					{
+						Joint* parent = static_cast<Joint*>(this->transforms[j]);
+						
+						// S^T * F
+						H.block(this->offsets[j], this->offsets[i], parent->getDof(), joint->getDof()).noalias() = parent->S.transpose() * F;
+						H.block(this->offsets[i], this->offsets[j], joint->getDof(), parent->getDof()) = H.block(this->offsets[j], this->offsets[i], parent->getDof(), joint->getDof()).transpose();
+					}
+				}
+			}
+		}
+		
 		void
 		Dynamic::forwardDynamics()
 		{
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			this->tree[this->root]->forwardDynamics1();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// X * v + vj
+					transform->out->v = transform->x * transform->in->v + joint->v;
+					// cj + v x vj
+					transform->out->c = joint->c + transform->out->v.cross(joint->v);
+				}
+				else
+				{
+					// X * v
+					transform->out->v = transform->x * transform->in->v;
+					transform->out->c.setZero();
+				}
+				
+				if (nullptr != this->successors[i])
+				{
+					Body* body = this->successors[i];
+					body->iA = body->i;
+					// v x I * v - X_0 * f^x
+					body->pA = body->v.cross(body->i * body->v) - body->x * body->fX;
+				}
+				else
+				{
+					transform->out->iA.setZero();
+					transform->out->pA.setZero();
+				}
+			}
+			
+			for (::std::size_t i = this->transforms.size(); i-- > 0;)
+			{
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// I^A * S
+					joint->U.noalias() = transform->out->iA.matrix() * joint->S;
+					// S^T * U
+					joint->D.noalias() = joint->S.transpose() * joint->U;
+					// tau - S^T * p^A
+					joint->u = joint->tau;
+					joint->u.noalias() -= joint->S.transpose() * transform->out->pA.matrix();
+					::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> D = joint->D;
+					// U * D^-1
+					::Eigen::Matrix< ::rl::math::Real, 6, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> UinvD = joint->U * D.inverse();
+					// I^A - U * D^-1 * U^T
+					::rl::math::Matrix66 UinvDU = UinvD * joint->U.transpose();
+					::rl::math::ArticulatedBodyInertia ia(transform->out->iA - ::rl::math::ArticulatedBodyInertia(UinvDU));
+					// p^A + I^a * c + U * D^-1 * u
+					::rl::math::Vector6 UinvDu = UinvD * joint->u;
+					::rl::math::ForceVector pa(transform->out->pA + ia * transform->out->c + ::rl::math::ForceVector(UinvDu));
+					// I^A + X^* * I^a * X
+					transform->in->iA = transform->in->iA + transform->x / ia;
+					// p^A + X^* * p^a
+					transform->in->pA = transform->in->pA + transform->x / pa;
+				}
+				else
+				{
+					// I^A + X^* * I^a * X
+					transform->in->iA = transform->in->iA + transform->x / transform->out->iA;
+					// p^A + I^a * c
+					::rl::math::ForceVector pa(transform->out->pA + transform->out->iA * transform->out->c);
+					// p^A + X^* * p^a
+					transform->in->pA = transform->in->pA + transform->x / pa;
+				}
+			}
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				Transform* transform = this->transforms[i];
+				
+				// X * a + c
+				transform->out->a = transform->x * transform->in->a + transform->out->c;
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// u - U^T * a'
+					::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, 1, ::Eigen::ColMajor, 6, 1> u = joint->u;
+					u.noalias() -= joint->U.transpose() * transform->out->a.matrix();
+					::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> D = joint->D;
+					// D^-1 * (u - U^T * a')
+					joint->qdd.noalias() = D.inverse() * u;
+					// S * qdd
+					joint->a = ::rl::math::Vector6(joint->S * joint->qdd);
+					// a' + S * qdd
+					transform->out->a = transform->out->a + joint->a;
+				}
+			}
+		}
+		
+		void
+		Dynamic::forwardDynamics(Workspace& workspace) const
+		{
+			::rl::math::MotionVector a0 = ::rl::math::MotionVector::Zero();
+			a0.linear() = this->getWorldGravity();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				// X * v
+				workspace.v[i] = ::std::numeric_limits< ::std::size_t>::max() != this->parents[i] ? workspace.x[i] * workspace.v[this->parents[i]] : ::rl::math::MotionVector::Zero();
+				workspace.c[i].setZero();
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S * qd
+					::rl::math::MotionVector vj(::rl::math::Vector6(joint->S * workspace.qd.segment(this->offsets[i], joint->getDof())));
+					// X * v + vj
+					workspace.v[i] = workspace.v[i] + vj;
+					// cj + v x vj
+					workspace.c[i] = joint->c + workspace.v[i].cross(vj);
+				}
+				
+				if (nullptr != this->successors[i])
+				{
+					Body* body = this->successors[i];
+					workspace.iA[i] = body->i;
+					// v x I * v - X_0 * f^x
+					workspace.pA[i] = workspace.v[i].cross(body->i * workspace.v[i]) - workspace.x0[i] * body->fX;
+				}
+				else
+				{
+					workspace.iA[i].setZero();
+					workspace.pA[i].setZero();
+				}
+			}
+			
+			for (::std::size_t i = this->transforms.size(); i-- > 0;)
 			{
-				(*i)->forwardDynamics1();
+				::rl::math::ArticulatedBodyInertia ia(workspace.iA[i]);
+				::rl::math::ForceVector pa(workspace.pA[i]);
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					::Eigen::Block< ::rl::math::Matrix> U = workspace.U.block(0, this->offsets[i], 6, joint->getDof());
+					::Eigen::Block< ::rl::math::Matrix> D = workspace.D.block(this->offsets[i], this->offsets[i], joint->getDof(), joint->getDof());
+					::Eigen::VectorBlock< ::rl::math::Vector> u = workspace.u.segment(this->offsets[i], joint->getDof());
+					// I^A * S
+					U.noalias() = workspace.iA[i].matrix() * joint->S;
+					// S^T * U
+					D.noalias() = joint->S.transpose() * U;
+					// tau - S^T * p^A
+					u = workspace.tau.segment(this->offsets[i], joint->getDof());
+					u.noalias() -= joint->S.transpose() * workspace.pA[i].matrix();
+					// U * D^-1
+					::Eigen::Matrix< ::rl::math::Real, 6, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6> UinvD = U * ::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6>(D).inverse();
+					// I^A - U * D^-1 * U^T
+					::rl::math::Matrix66 UinvDU = UinvD * U.transpose();
+					ia = workspace.iA[i] - ::rl::math::ArticulatedBodyInertia(UinvDU);
+					// p^A + I^a * c + U * D^-1 * u
+					::rl::math::Vector6 UinvDu = UinvD * u;
+					pa = workspace.pA[i] + ia * workspace.c[i] + ::rl::math::ForceVector(UinvDu);
+				}
+				else
+				{
+					// p^A + I^a * c
+					pa = workspace.pA[i] + ia * workspace.c[i];
+				}
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->parents[i])
+				{
+					// I^A + X^* * I^a * X
+					workspace.iA[this->parents[i]] = workspace.iA[this->parents[i]] + workspace.x[i] / ia;
+					// p^A + X^* * p^a
+					workspace.pA[this->parents[i]] = workspace.pA[this->parents[i]] + workspace.x[i] / pa;
+				}
 			}
 			
-			for (::std::vector<Element*>::reverse_iterator i = this->elements.rbegin(); i != this->elements.rend(); ++i)
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
 			{
-				(*i)->forwardDynamics2();
+				// X * a + c
+				workspace.a[i] = workspace.x[i] * (::std::numeric_limits< ::std::size_t>::max() != this->parents[i] ? workspace.a[this->parents[i]] : a0) + workspace.c[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					::Eigen::VectorBlock< ::rl::math::Vector> qdd = workspace.qdd.segment(this->offsets[i], joint->getDof());
+					// u - U^T * a'
+					::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, 1, ::Eigen::ColMajor, 6, 1> u = workspace.u.segment(this->offsets[i], joint->getDof());
+					u.noalias() -= workspace.U.block(0, this->offsets[i], 6, joint->getDof()).transpose() * workspace.a[i].matrix();
+					// D^-1 * (u - U^T * a')
+					qdd.noalias() = ::Eigen::Matrix< ::rl::math::Real, ::Eigen::Dynamic, ::Eigen::Dynamic, ::Eigen::ColMajor, 6, 6>(workspace.D.block(this->offsets[i], this->offsets[i], joint->getDof(), joint->getDof())).inverse() * u;
+					// a' + S * qdd
+					workspace.a[i] = workspace.a[i] + ::rl::math::MotionVector(::rl::math::Vector6(joint->S * qdd));
+				}
 			}
+		}
+		
+		void
+		Dynamic::forwardDynamics(Workspace& workspace, const ::rl::math::Matrix& q, const ::rl::math::Matrix& qd, const ::rl::math::Matrix& tau, ::rl::math::Matrix& qdd) const
+		{
+			assert(q.cols() == qd.cols());
+			assert(q.cols() == tau.cols());
+			
+			qdd.resize(this->getDof(), q.cols());
 			
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			for (::std::ptrdiff_t i = 0; i < q.cols(); ++i)
 			{
-				(*i)->forwardDynamics3();
+				workspace.q = q.col(i);
+				workspace.qd = qd.col(i);
+				workspace.tau = tau.col(i);
+				this->forwardPosition(workspace);
+				this->forwardDynamics(workspace);
+				qdd.col(i) = workspace.qdd;
 			}
 		}
 		
@@ -224,14 +691,75 @@ namespace rl
 		void
 		Dynamic::inverseDynamics()
 		{
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			this->tree[this->root]->inverseDynamics1();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
 			{
-				(*i)->inverseDynamics1();
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// X * v + vj
+					transform->out->v = transform->x * transform->in->v + joint->v;
+					// X * a + aj + cj + v x vj
+					transform->out->a = transform->x * transform->in->a + joint->a + joint->c + transform->out->v.cross(joint->v);
+				}
+				else
+				{
+					// X * v
+					transform->out->v = transform->x * transform->in->v;
+					// X * a
+					transform->out->a = transform->x * transform->in->a;
+				}
+				
+				if (nullptr != this->successors[i])
+				{
+					Body* body = this->successors[i];
+					// I * a + v x I * v - X_0 * f^x
+					body->f = body->i * body->a + body->v.cross(body->i * body->v) - body->x * body->fX;
+				}
+				else
+				{
+					transform->out->f.setZero();
+				}
 			}
 			
-			for (::std::vector<Element*>::reverse_iterator i = this->elements.rbegin(); i != this->elements.rend(); ++i)
+			for (::std::size_t i = this->transforms.size(); i-- > 0;)
+			{
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// S^T * f
+					joint->tau.noalias() = joint->S.transpose() * transform->out->f.matrix();
+				}
+				
+				// f + X * f
+				transform->in->f = transform->in->f + transform->x / transform->out->f;
+			}
+		}
+		
+		void
+		Dynamic::inverseDynamics(Workspace& workspace) const
+		{
+			this->recursiveNewtonEuler(workspace, workspace.qd, workspace.qdd, workspace.tau);
+		}
+		
+		void
+		Dynamic::inverseDynamics(Workspace& workspace, const ::rl::math::Matrix& q, const ::rl::math::Matrix& qd, const ::rl::math::Matrix& qdd, ::rl::math::Matrix& tau) const
+		{
+			assert(q.cols() == qd.cols());
+			assert(q.cols() == qdd.cols());
+			
+			tau.resize(this->getDof(), q.cols());
+			
+			for (::std::ptrdiff_t i = 0; i < q.cols(); ++i)
 			{
-				(*i)->inverseDynamics2();
+				workspace.q = q.col(i);
+				this->forwardPosition(workspace);
+				this->recursiveNewtonEuler(workspace, qd.col(i), qdd.col(i), tau.col(i));
 			}
 		}
 		
@@ -244,6 +772,67 @@ namespace rl
 			}
 		}
 		
+		void
+		Dynamic::recursiveNewtonEuler(Workspace& workspace, const ::rl::math::ConstVectorRef& qd, const ::rl::math::ConstVectorRef& qdd, ::rl::math::VectorRef tau) const
+		{
+			::rl::math::MotionVector a0 = ::rl::math::MotionVector::Zero();
+			a0.linear() = this->getWorldGravity();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() != this->parents[i])
+				{
+					// X * v
+					workspace.v[i] = workspace.x[i] * workspace.v[this->parents[i]];
+					// X * a
+					workspace.a[i] = workspace.x[i] * workspace.a[this->parents[i]];
+				}
+				else
+				{
+					workspace.v[i].setZero();
+					workspace.a[i] = workspace.x[i] * a0;
+				}
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S * qd
+					::rl::math::MotionVector vj(::rl::math::Vector6(joint->S * qd.segment(this->offsets[i], joint->getDof())));
+					// X * v + vj
+					workspace.v[i] = workspace.v[i] + vj;
+					// X * a + aj + cj + v x vj
+					workspace.a[i] = workspace.a[i] + ::rl::math::MotionVector(::rl::math::Vector6(joint->S * qdd.segment(this->offsets[i], joint->getDof()))) + joint->c + workspace.v[i].cross(vj);
+				}
+				
+				if (nullptr != this->successors[i])
+				{
+					Body* body = this->successors[i];
+					// I * a + v x I * v - X_0 * f^x
+					workspace.f[i] = body->i * workspace.a[i] + workspace.v[i].cross(body->i * workspace.v[i]) - workspace.x0[i] * body->fX;
+				}
+				else
+				{
+					workspace.f[i].setZero();
+				}
+			}
+			
+			for (::std::size_t i = this->transforms.size(); i-- > 0;)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S^T * f
+					tau.segment(this->offsets[i], joint->getDof()).noalias() = joint->S.transpose() * workspace.f[i].matrix();
+				}
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->parents[i])
+				{
+					// f + X * f
+					workspace.f[this->parents[i]] = workspace.f[this->parents[i]] + workspace.x[i] / workspace.f[i];
+				}
+			}
+		}
+		
 		void
 		Dynamic::update()
 		{
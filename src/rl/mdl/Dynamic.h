@@ -63,6 +63,27 @@ namespace rl
 			 */
 			void calculateCentrifugalCoriolis(::rl::math::Vector& V);
 			
+			/**
+			 * Calculate partial derivatives of forward dynamics.
+			 * 
+			 * Derivatives are taken with respect to the velocity coordinates,
+			 * i.e., for joints with quaternion positions with respect to a
+			 * rotation vector applied as in Joint::step(). External forces are
+			 * treated as constant.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms, velocity,
+			 * and torque
+			 * @param[out] dqdddq Partial derivative \f$\frac{\partial \ddot{\vec{q}}}{\partial \vec{q}}\f$
+			 * @param[out] dqdddqd Partial derivative \f$\frac{\partial \ddot{\vec{q}}}{\partial \dot{\vec{q}}}\f$
+			 * @param[out] dqdddtau Partial derivative \f$\frac{\partial \ddot{\vec{q}}}{\partial \vec{\tau}} = \matr{M}^{-1}(\vec{q})\f$
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 * @post Workspace::qdd
+			 * 
+			 * @see calculateInverseDynamicsDerivatives()
+			 */
+			void calculateForwardDynamicsDerivatives(Workspace& workspace, ::rl::math::Matrix& dqdddq, ::rl::math::Matrix& dqdddqd, ::rl::math::Matrix& dqdddtau) const;
+			
 			/**
 			 * Calculate gravity vector.
 			 * 
@@ -85,7 +106,47 @@ namespace rl
 			void calculateGravity(::rl::math::Vector& G);
 			
 			/**
-			 * Calculate joint space mass matrix.
+			 * Calculate gravity vector without modifying the model.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms
+			 * @param[out] G Gravity vector \f$\vec{G}(\vec{q})\f$
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 * 
+			 * @see inverseDynamics(Workspace&) const
+			 */
+			void calculateGravity(Workspace& workspace, ::rl::math::Vector& G) const;
+			
+			/**
+			 * Calculate gravity vectors for a batch of joint positions.
+			 * 
+			 * @param[in,out] workspace Workspace used for all samples
+			 * @param[in] q Joint positions, one column per sample
+			 * @param[out] G Gravity vectors, one column per sample
+			 */
+			void calculateGravity(Workspace& workspace, const ::rl::math::Matrix& q, ::rl::math::Matrix& G) const;
+			
+			/**
+			 * Calculate partial derivatives of inverse dynamics by propagating
+			 * derivatives through the recursive Newton-Euler algorithm.
+			 * 
+			 * Derivatives are taken with respect to the velocity coordinates,
+			 * i.e., for joints with quaternion positions with respect to a
+			 * rotation vector applied as in Joint::step(). External forces are
+			 * treated as constant.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms, velocity,
+			 * and acceleration
+			 * @param[out] dtaudq Partial derivative \f$\frac{\partial \vec{\tau}}{\partial \vec{q}}\f$
+			 * @param[out] dtaudqd Partial derivative \f$\frac{\partial \vec{\tau}}{\partial \dot{\vec{q}}}\f$
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 * @post Workspace::tau
+			 */
+			void calculateInverseDynamicsDerivatives(Workspace& workspace, ::rl::math::Matrix& dtaudq, ::rl::math::Matrix& dtaudqd) const;
+			
+			/**
+			 * Calculate joint space mass matrix via composite-rigid-body algorithm.
 			 * 
 			 * @pre setPosition()
 			 * @post getMassMatrix()
@@ -95,9 +156,9 @@ namespace rl
 			void calculateMassMatrix();
 			
 			/**
-			 * Calculate joint space mass matrix.
+			 * Calculate joint space mass matrix via composite-rigid-body algorithm.
 			 * 
-			 * @param[out] M Joint space mass matrix \f$\matr{M}^{-1}(\vec{q})\f$
+			 * @param[out] M Joint space mass matrix \f$\matr{M}(\vec{q})\f$
 			 * 
 			 * @pre setPosition()
 			 * 
@@ -106,7 +167,29 @@ namespace rl
 			void calculateMassMatrix(::rl::math::Matrix& M);
 			
 			/**
-			 * Calculate joint space mass matrix inverse.
+			 * Calculate joint space mass matrix via composite-rigid-body algorithm
+			 * without modifying the model.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms
+			 * @param[out] M Joint space mass matrix \f$\matr{M}(\vec{q})\f$
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 */
+			void calculateMassMatrix(Workspace& workspace, ::rl::math::Matrix& M) const;
+			
+			/**
+			 * Calculate joint space mass matrices for a batch of joint positions.
+			 * 
+			 * @param[in,out] workspace Workspace used for all samples
+			 * @param[in] q Joint positions, one column per sample
+			 * @param[out] M Joint space mass matrices, one block of columns per
+			 * sample
+			 */
+			void calculateMassMatrix(Workspace& workspace, const ::rl::math::Matrix& q, ::rl::math::Matrix& M) const;
+			
+			/**
+			 * Calculate joint space mass matrix inverse via sparse
+			 * \f$\matr{L}^{\mathrm{T}} \matr{L}\f$ factorization.
 			 * 
 			 * @pre setPosition()
 			 * @post getMassMatrixInverse()
@@ -116,7 +199,8 @@ namespace rl
 			void calculateMassMatrixInverse();
 			
 			/**
-			 * Calculate joint space mass matrix inverse.
+			 * Calculate joint space mass matrix inverse via sparse
+			 * \f$\matr{L}^{\mathrm{T}} \matr{L}\f$ factorization.
 			 * 
 			 * @param[out] invM Joint space mass matrix inverse \f$\matr{M}^{-1}(\vec{q})\f$
 			 * 
@@ -158,6 +242,29 @@ namespace rl
 			 */
 			void forwardDynamics();
 			
+			/**
+			 * Forward dynamics via articulated-body algorithm without modifying
+			 * the model.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms, velocity,
+			 * and torque
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 * @post Workspace::qdd
+			 */
+			void forwardDynamics(Workspace& workspace) const;
+			
+			/**
+			 * Forward dynamics for a batch of states.
+			 * 
+			 * @param[in,out] workspace Workspace used for all samples
+			 * @param[in] q Joint positions, one column per sample
+			 * @param[in] qd Joint velocities, one column per sample
+			 * @param[in] tau Joint torques, one column per sample
+			 * @param[out] qdd Joint accelerations, one column per sample
+			 */
+			void forwardDynamics(Workspace& workspace, const ::rl::math::Matrix& q, const ::rl::math::Matrix& qd, const ::rl::math::Matrix& tau, ::rl::math::Matrix& qdd) const;
+			
 			/**
 			 * Access calculated centrifugal and Coriolis vector.
 			 * 
@@ -224,6 +331,29 @@ namespace rl
 			 */
 			void inverseDynamics();
 			
+			/**
+			 * Inverse dynamics via recursive Newton-Euler algorithm without
+			 * modifying the model.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms, velocity,
+			 * and acceleration
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 * @post Workspace::tau
+			 */
+			void inverseDynamics(Workspace& workspace) const;
+			
+			/**
+			 * Inverse dynamics for a batch of states.
+			 * 
+			 * @param[in,out] workspace Workspace used for all samples
+			 * @param[in] q Joint positions, one column per sample
+			 * @param[in] qd Joint velocities, one column per sample
+			 * @param[in] qdd Joint accelerations, one column per sample
+			 * @param[out] tau Joint torques, one column per sample
+			 */
+			void inverseDynamics(Workspace& workspace, const ::rl::math::Matrix& q, const ::rl::math::Matrix& qd, const ::rl::math::Matrix& qdd, ::rl::math::Matrix& tau) const;
+			
 			void inverseForce();
 			
 			virtual void update();
@@ -285,7 +415,26 @@ namespace rl
 			::rl::math::Vector V;
 			
 		private:
+			/**
+			 * Composite-rigid-body algorithm.
+			 * 
+			 * @param[out] H Joint space inertia matrix in joint coordinates
+			 * 
+			 * @pre setPosition()
+			 */
+			void compositeRigidBody(::rl::math::Matrix& H);
 			
+			/**
+			 * Recursive Newton-Euler algorithm on a workspace.
+			 * 
+			 * @param[in,out] workspace Workspace with joint transforms
+			 * @param[in] qd Joint velocity
+			 * @param[in] qdd Joint acceleration
+			 * @param[out] tau Joint torque
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 */
+			void recursiveNewtonEuler(Workspace& workspace, const ::rl::math::ConstVectorRef& qd, const ::rl::math::ConstVectorRef& qdd, ::rl::math::VectorRef tau) const;
 		};
 	}
 }
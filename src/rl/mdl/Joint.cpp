@@ -305,6 +305,13 @@ namespace rl
 			this->a = this->S * this->qdd;
 		}
 		
+		void
+		Joint::setPosition(const ::rl::math::ConstVectorRef& q)
+		{
+			this->q = q;
+			this->calculateTransform(this->q, this->x);
+		}
+		
 		void
 		Joint::setTorque(const ::rl::math::ConstVectorRef& tau)
 		{
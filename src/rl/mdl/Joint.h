@@ -43,6 +43,17 @@ namespace rl
 			
 			virtual ~Joint();
 			
+			/**
+			 * Calculate Pluecker transform of joint for a given position.
+			 * 
+			 * Unlike setPosition(), this does not modify the joint.
+			 * 
+			 * @param[in] q Joint position
+			 * @param[in,out] x Pluecker transform, only the components
+			 * depending on the joint position are updated
+			 */
+			virtual void calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const = 0;
+			
 			virtual void clamp(::rl::math::VectorRef q) const;
 			
 			virtual ::rl::math::Real distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
@@ -101,7 +112,7 @@ namespace rl
 			
 			void setAcceleration(const ::rl::math::ConstVectorRef& qdd);
 			
-			virtual void setPosition(const ::rl::math::ConstVectorRef& q) = 0;
+			virtual void setPosition(const ::rl::math::ConstVectorRef& q);
 			
 			void setTorque(const ::rl::math::ConstVectorRef& tau);
 			
@@ -25,6 +25,7 @@
 //
 
 #include <algorithm>
+#include <limits>
 #include <stack>
 #include <boost/graph/graphviz.hpp>
 #include <rl/math/Quaternion.h>
@@ -33,6 +34,8 @@
 #include <rl/math/Unit.h>
 
 #include "Exception.h"
+#include "Frame.h"
+#include "Joint.h"
 #include "Kinematic.h"
 #include "Prismatic.h"
 #include "Revolute.h"
@@ -65,30 +68,82 @@ namespace rl
 			assert(J.rows() == this->getOperationalDof() * 6);
 			assert(J.cols() == this->getDof());
 			
-			::rl::math::Vector tmp(this->getDof());
+			J.setZero();
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
 			{
-				for (::std::size_t j = 0; j < this->getDof(); ++j)
-				{
-					tmp(j) = i == j ? 1 : 0;
-				}
+				::std::size_t j = ::std::find(this->transforms.begin(), this->transforms.end(), this->tree[this->tools[i]].get()) - this->transforms.begin();
 				
-				this->setVelocity(tmp);
-				this->forwardVelocity();
+				::rl::math::PlueckerTransform x = ::rl::math::PlueckerTransform::Identity();
 				
-				for (::std::size_t j = 0; j < this->getOperationalDof(); ++j)
+				for (; ::std::numeric_limits< ::std::size_t>::max() != j; j = this->parents[j])
 				{
-					if (inWorldFrame)
+					if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[j])
 					{
-						J.block(j * 6, i, 3, 1) = this->getOperationalPosition(j).linear() * this->getOperationalVelocity(j).linear();
-						J.block(j * 6 + 3, i, 3, 1) = this->getOperationalPosition(j).linear() * this->getOperationalVelocity(j).angular();
+						Joint* joint = static_cast<Joint*>(this->transforms[j]);
+						
+						for (::std::size_t k = 0; k < joint->getDof(); ++k)
+						{
+							// X * S
+							::rl::math::MotionVector s = x * ::rl::math::MotionVector(joint->S.col(k));
+							
+							J.block(i * 6, this->offsets[j] + k, 3, 1) = s.linear();
+							J.block(i * 6 + 3, this->offsets[j] + k, 3, 1) = s.angular();
+						}
 					}
-					else
+					
+					x = this->transforms[j]->x * x;
+				}
+				
+				if (inWorldFrame)
+				{
+					::rl::math::Matrix33 R = this->tree[this->root]->x.linear() * x.linear();
+					J.middleRows(i * 6, 3) = R * J.middleRows(i * 6, 3);
+					J.middleRows(i * 6 + 3, 3) = R * J.middleRows(i * 6 + 3, 3);
+				}
+			}
+			
+			J = J * this->gammaVelocity;
+		}
+		
+		void
+		Kinematic::calculateJacobian(const Workspace& workspace, ::rl::math::Matrix& J, const bool& inWorldFrame) const
+		{
+			assert(J.rows() == this->getOperationalDof() * 6);
+			assert(J.cols() == this->getDof());
+			
+			J.setZero();
+			
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+			{
+				::std::size_t j = ::std::find(this->transforms.begin(), this->transforms.end(), this->tree[this->tools[i]].get()) - this->transforms.begin();
+				
+				::rl::math::PlueckerTransform x = ::rl::math::PlueckerTransform::Identity();
+				
+				for (; ::std::numeric_limits< ::std::size_t>::max() != j; j = this->parents[j])
+				{
+					if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[j])
 					{
-						J.block(j * 6, i, 3, 1) = this->getOperationalVelocity(j).linear();
-						J.block(j * 6 + 3, i, 3, 1) = this->getOperationalVelocity(j).angular();
+						Joint* joint = static_cast<Joint*>(this->transforms[j]);
+						
+						for (::std::size_t k = 0; k < joint->getDof(); ++k)
+						{
+							// X * S
+							::rl::math::MotionVector s = x * ::rl::math::MotionVector(joint->S.col(k));
+							
+							J.block(i * 6, this->offsets[j] + k, 3, 1) = s.linear();
+							J.block(i * 6 + 3, this->offsets[j] + k, 3, 1) = s.angular();
+						}
 					}
+					
+					x = workspace.x[j] * x;
+				}
+				
+				if (inWorldFrame)
+				{
+					::rl::math::Matrix33 R = this->tree[this->root]->x.linear() * x.linear();
+					J.middleRows(i * 6, 3) = R * J.middleRows(i * 6, 3);
+					J.middleRows(i * 6 + 3, 3) = R * J.middleRows(i * 6 + 3, 3);
 				}
 			}
 		}
@@ -102,11 +157,33 @@ namespace rl
 		void
 		Kinematic::calculateJacobianDerivative(::rl::math::Vector& Jdqd, const bool& inWorldFrame)
 		{
-			::rl::math::Vector tmp = ::rl::math::Vector::Zero(this->getDof());
+			this->tree[this->root]->a.setZero();
 			
-			this->setAcceleration(tmp);
-			this->forwardVelocity();
-			this->forwardAcceleration();
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				Transform* transform = this->transforms[i];
+				
+				if (inWorldFrame)
+				{
+					transform->forwardPosition();
+				}
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// X * v + vj
+					transform->out->v = transform->x * transform->in->v + joint->v;
+					// X * a + cj + v x vj
+					transform->out->a = transform->x * transform->in->a + joint->c + transform->out->v.cross(joint->v);
+				}
+				else
+				{
+					// X * v
+					transform->out->v = transform->x * transform->in->v;
+					// X * a
+					transform->out->a = transform->x * transform->in->a;
+				}
+			}
 			
 			for (::std::size_t j = 0; j < this->getOperationalDof(); ++j)
 			{
@@ -174,27 +251,84 @@ namespace rl
 		void
 		Kinematic::forwardAcceleration()
 		{
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			this->tree[this->root]->forwardAcceleration();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
 			{
-				(*i)->forwardAcceleration();
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(transform);
+					// X * a + aj + cj + v x vj
+					transform->out->a = transform->x * transform->in->a + joint->a + joint->c + transform->out->v.cross(joint->v);
+				}
+				else
+				{
+					// X * a
+					transform->out->a = transform->x * transform->in->a;
+				}
 			}
 		}
 		
 		void
 		Kinematic::forwardPosition()
 		{
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			this->tree[this->root]->forwardPosition();
+			
+			for (::std::vector<Transform*>::iterator i = this->transforms.begin(); i != this->transforms.end(); ++i)
 			{
-				(*i)->forwardPosition();
+				// X_0 * X
+				(*i)->out->x = (*i)->in->x * (*i)->x;
+			}
+		}
+		
+		void
+		Kinematic::forwardPosition(Workspace& workspace) const
+		{
+			for (::std::size_t i = 0, j = 0; i < this->transforms.size(); ++i)
+			{
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					joint->calculateTransform(workspace.q.segment(j, joint->getDofPosition()), workspace.x[i]);
+					j += joint->getDofPosition();
+				}
+				else
+				{
+					workspace.x[i] = this->transforms[i]->x;
+				}
+				
+				// X_0 * X
+				workspace.x0[i] = (::std::numeric_limits< ::std::size_t>::max() != this->parents[i] ? workspace.x0[this->parents[i]] : this->tree[this->root]->x) * workspace.x[i];
+			}
+			
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+			{
+				::std::size_t j = ::std::find(this->transforms.begin(), this->transforms.end(), this->tree[this->tools[i]].get()) - this->transforms.begin();
+				workspace.operational[i] = workspace.x0[j].transform();
 			}
 		}
 		
 		void
 		Kinematic::forwardVelocity()
 		{
-			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			this->tree[this->root]->forwardVelocity();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
 			{
-				(*i)->forwardVelocity();
+				Transform* transform = this->transforms[i];
+				
+				if (::std::numeric_limits< ::std::size_t>::max() != this->offsets[i])
+				{
+					// X * v + vj
+					transform->out->v = transform->x * transform->in->v + static_cast<Joint*>(transform)->v;
+				}
+				else
+				{
+					// X * v
+					transform->out->v = transform->x * transform->in->v;
+				}
 			}
 		}
 		
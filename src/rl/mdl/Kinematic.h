@@ -30,6 +30,7 @@
 #include <rl/math/Matrix.h>
 
 #include "Metric.h"
+#include "Workspace.h"
 
 namespace rl
 {
@@ -68,6 +69,17 @@ namespace rl
 			 */
 			void calculateJacobian(::rl::math::Matrix& J, const bool& inWorldFrame = true);
 			
+			/**
+			 * Calculate Jacobian matrix without modifying the model.
+			 * 
+			 * @param[in] workspace Workspace with joint transforms
+			 * @param[out] J Jacobian matrix \f$\matr{J}(\vec{q})\f$
+			 * @param[in] inWorldFrame Calculate in world or tool frame
+			 * 
+			 * @pre forwardPosition(Workspace&) const
+			 */
+			void calculateJacobian(const Workspace& workspace, ::rl::math::Matrix& J, const bool& inWorldFrame = true) const;
+			
 			/**
 			 * Calculate Jacobian derivative vector.
 			 * 
@@ -164,6 +176,16 @@ namespace rl
 			 */
 			void forwardPosition();
 			
+			/**
+			 * Calculate joint transforms and frame positions without modifying
+			 * the model.
+			 * 
+			 * @param[in,out] workspace Workspace with joint position
+			 * 
+			 * @post Workspace::operational
+			 */
+			void forwardPosition(Workspace& workspace) const;
+			
 			/**
 			 * @pre setPosition()
 			 * @pre setVelocity()
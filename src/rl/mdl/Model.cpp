@@ -24,6 +24,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <limits>
+
 #include "Body.h"
 #include "Compound.h"
 #include "Exception.h"
@@ -45,10 +47,14 @@ namespace rl
 			invGammaPosition(),
 			invGammaVelocity(),
 			joints(),
+			lambda(),
 			leaves(),
 			manufacturer(),
 			name(),
+			offsets(),
+			parents(),
 			root(0),
+			successors(),
 			tools(),
 			transforms(),
 			tree(),
@@ -733,12 +739,53 @@ namespace rl
 		{
 			this->bodies.clear();
 			this->elements.clear();
+			this->frames.clear();
 			this->joints.clear();
 			this->leaves.clear();
 			this->tools.clear();
 			this->transforms.clear();
 			
 			this->update(this->root);
+			
+			this->lambda.assign(this->getDof(), ::std::numeric_limits< ::std::size_t>::max());
+			this->offsets.assign(this->transforms.size(), ::std::numeric_limits< ::std::size_t>::max());
+			this->parents.assign(this->transforms.size(), ::std::numeric_limits< ::std::size_t>::max());
+			this->successors.assign(this->transforms.size(), nullptr);
+			
+			for (::std::size_t i = 0, j = 0; i < this->transforms.size(); ++i)
+			{
+				this->successors[i] = dynamic_cast<Body*>(this->transforms[i]->out);
+				
+				for (::std::size_t k = 0; k < i; ++k)
+				{
+					if (this->transforms[k]->out == this->transforms[i]->in)
+					{
+						this->parents[i] = k;
+						break;
+					}
+				}
+				
+				if (Joint* joint = dynamic_cast<Joint*>(this->transforms[i]))
+				{
+					this->offsets[i] = j;
+					
+					for (::std::size_t k = this->parents[i]; k != ::std::numeric_limits< ::std::size_t>::max(); k = this->parents[k])
+					{
+						if (this->offsets[k] != ::std::numeric_limits< ::std::size_t>::max())
+						{
+							this->lambda[j] = this->offsets[k] + static_cast<Joint*>(this->transforms[k])->getDof() - 1;
+							break;
+						}
+					}
+					
+					for (::std::size_t k = 1; k < joint->getDof(); ++k)
+					{
+						this->lambda[j + k] = j + k - 1;
+					}
+					
+					j += joint->getDof();
+				}
+			}
 		}
 		
 		void
@@ -262,14 +262,39 @@ namespace rl
 			
 			::std::vector<Joint*> joints;
 			
+			/**
+			 * Parent degree of freedom \f$\lambda(i)\f$ of each velocity
+			 * coordinate, or maximum value of std::size_t if there is none.
+			 */
+			::std::vector< ::std::size_t> lambda;
+			
 			::std::vector<Vertex> leaves;
 			
 			::std::string manufacturer;
 			
 			::std::string name;
 			
+			/**
+			 * Offset of the first velocity coordinate of each transform in
+			 * transforms, or maximum value of std::size_t for fixed transforms.
+			 */
+			::std::vector< ::std::size_t> offsets;
+			
+			/**
+			 * Index of the transform leading into the input frame of each
+			 * transform in transforms, or maximum value of std::size_t if
+			 * it is attached to the root frame.
+			 */
+			::std::vector< ::std::size_t> parents;
+			
 			Vertex root;
 			
+			/**
+			 * Body attached to the output frame of each transform in
+			 * transforms, or nullptr if it is not a body.
+			 */
+			::std::vector<Body*> successors;
+			
 			::std::vector<Edge> tools;
 			
 			::std::vector<Transform*> transforms;
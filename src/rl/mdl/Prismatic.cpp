@@ -46,10 +46,9 @@ namespace rl
 		}
 		
 		void
-		Prismatic::setPosition(const ::rl::math::ConstVectorRef& q)
+		Prismatic::calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const
 		{
-			this->q = q;
-			this->x.translation() = this->S.block<3, 1>(3, 0) * (this->q(0) + this->offset(0));
+			x.translation() = this->S.block<3, 1>(3, 0) * (q(0) + this->offset(0));
 		}
 	}
 }
@@ -47,6 +47,12 @@ namespace rl
 		{
 		}
 		
+		void
+		Revolute::calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const
+		{
+			x.linear() = ::rl::math::AngleAxis(q(0) + this->offset(0), this->S.block<3, 1>(0, 0)).toRotationMatrix();
+		}
+		
 		::rl::math::Real
 		Revolute::distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
@@ -118,13 +124,6 @@ namespace rl
 			}
 		}
 		
-		void
-		Revolute::setPosition(const ::rl::math::ConstVectorRef& q)
-		{
-			this->q = q;
-			this->x.linear() = ::rl::math::AngleAxis(this->q(0) + this->offset(0), this->S.block<3, 1>(0, 0)).toRotationMatrix();
-		}
-		
 		::rl::math::Real
 		Revolute::transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
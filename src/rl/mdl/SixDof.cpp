@@ -79,6 +79,13 @@ namespace rl
 		{
 		}
 		
+		void
+		SixDof::calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const
+		{
+			x.translation() = q.head<3>() + this->offset.head<3>();
+			x.linear() = ::Eigen::Map<const ::rl::math::Quaternion>(q.tail<4>().data()).toRotationMatrix();
+		}
+		
 		void
 		SixDof::clamp(::rl::math::VectorRef q) const
 		{
@@ -167,14 +174,6 @@ namespace rl
 			}
 		}
 		
-		void
-		SixDof::setPosition(const ::rl::math::ConstVectorRef& q)
-		{
-			this->q = q;
-			this->x.translation() = this->q.head<3>() + this->offset.head<3>();
-			this->x.linear() = ::Eigen::Map<const ::rl::math::Quaternion>(this->q.tail<4>().data()).toRotationMatrix();
-		}
-		
 		void
 		SixDof::step(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& dq, ::rl::math::VectorRef q2) const
 		{
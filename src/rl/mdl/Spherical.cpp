@@ -62,6 +62,12 @@ namespace rl
 		{
 		}
 		
+		void
+		Spherical::calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const
+		{
+			x.linear() = ::Eigen::Map<const ::rl::math::Quaternion>(q.data()).toRotationMatrix();
+		}
+		
 		void
 		Spherical::clamp(::rl::math::VectorRef q) const
 		{
@@ -123,13 +129,6 @@ namespace rl
 			}
 		}
 		
-		void
-		Spherical::setPosition(const ::rl::math::ConstVectorRef& q)
-		{
-			this->q = q;
-			this->x.linear() = ::Eigen::Map<const ::rl::math::Quaternion>(this->q.data()).toRotationMatrix();
-		}
-		
 		void
 		Spherical::step(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& dq, ::rl::math::VectorRef q2) const
 		{
@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Model.h"
+#include "Workspace.h"
+
+namespace rl
+{
+	namespace mdl
+	{
+		Workspace::Workspace(const Model* model) :
+			a(model->getTransforms(), ::rl::math::MotionVector::Zero()),
+			c(model->getTransforms(), ::rl::math::MotionVector::Zero()),
+			D(::rl::math::Matrix::Zero(model->getDof(), model->getDof())),
+			f(model->getTransforms(), ::rl::math::ForceVector::Zero()),
+			iA(model->getTransforms(), ::rl::math::ArticulatedBodyInertia::Zero()),
+			iC(model->getTransforms(), ::rl::math::RigidBodyInertia::Zero()),
+			operational(model->getOperationalDof(), ::rl::math::Transform::Identity()),
+			pA(model->getTransforms(), ::rl::math::ForceVector::Zero()),
+			q(model->getGammaPosition() * model->getPosition()),
+			qd(::rl::math::Vector::Zero(model->getDof())),
+			qdd(::rl::math::Vector::Zero(model->getDof())),
+			tau(::rl::math::Vector::Zero(model->getDof())),
+			u(::rl::math::Vector::Zero(model->getDof())),
+			U(::rl::math::Matrix::Zero(6, model->getDof())),
+			v(model->getTransforms(), ::rl::math::MotionVector::Zero()),
+			x(model->getTransforms(), ::rl::math::PlueckerTransform::Identity()),
+			x0(model->getTransforms(), ::rl::math::PlueckerTransform::Identity())
+		{
+		}
+		
+		Workspace::~Workspace()
+		{
+		}
+	}
+}
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_MDL_WORKSPACE_H
+#define RL_MDL_WORKSPACE_H
+
+#include <vector>
+#include <rl/math/Matrix.h>
+#include <rl/math/Spatial.h>
+#include <rl/math/Transform.h>
+#include <rl/math/Vector.h>
+
+namespace rl
+{
+	namespace mdl
+	{
+		class Model;
+		
+		/**
+		 * Per-thread state of a kinematic or dynamic evaluation.
+		 * 
+		 * Holds joint space and spatial quantities that would otherwise be
+		 * stored in the elements of a Model, so that the const overloads in
+		 * Kinematic and Dynamic taking a Workspace can be called
+		 * concurrently on a single shared model, using one workspace per
+		 * thread.
+		 * 
+		 * Spatial quantities are indexed like the transforms of the model
+		 * and refer to the output frame of the respective transform.
+		 * Joint space quantities are not transformed by gammaPosition or
+		 * gammaVelocity.
+		 * 
+		 * @see Kinematic::forwardPosition(Workspace&) const
+		 */
+		class RL_MDL_EXPORT Workspace
+		{
+		public:
+			EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+			
+			Workspace(const Model* model);
+			
+			virtual ~Workspace();
+			
+			/** Spatial acceleration of output frame. */
+			::std::vector< ::rl::math::MotionVector, ::Eigen::aligned_allocator< ::rl::math::MotionVector>> a;
+			
+			/** Velocity-product acceleration of output frame. */
+			::std::vector< ::rl::math::MotionVector, ::Eigen::aligned_allocator< ::rl::math::MotionVector>> c;
+			
+			/** Joint space inertia of each degree of freedom block. */
+			::rl::math::Matrix D;
+			
+			/** Spatial force of output frame. */
+			::std::vector< ::rl::math::ForceVector, ::Eigen::aligned_allocator< ::rl::math::ForceVector>> f;
+			
+			/** Articulated-body inertia of output frame. */
+			::std::vector< ::rl::math::ArticulatedBodyInertia, ::Eigen::aligned_allocator< ::rl::math::ArticulatedBodyInertia>> iA;
+			
+			/** Composite-rigid-body inertia of output frame. */
+			::std::vector< ::rl::math::RigidBodyInertia, ::Eigen::aligned_allocator< ::rl::math::RigidBodyInertia>> iC;
+			
+			/** Operational position of each tool frame in world coordinates. */
+			::std::vector< ::rl::math::Transform, ::Eigen::aligned_allocator< ::rl::math::Transform>> operational;
+			
+			/** Articulated-body bias force of output frame. */
+			::std::vector< ::rl::math::ForceVector, ::Eigen::aligned_allocator< ::rl::math::ForceVector>> pA;
+			
+			/** Joint position. */
+			::rl::math::Vector q;
+			
+			/** Joint velocity. */
+			::rl::math::Vector qd;
+			
+			/** Joint acceleration. */
+			::rl::math::Vector qdd;
+			
+			/** Joint torque. */
+			::rl::math::Vector tau;
+			
+			/** Articulated-body bias force projected onto joint space. */
+			::rl::math::Vector u;
+			
+			/** Articulated-body inertia projected onto motion subspace. */
+			::rl::math::Matrix U;
+			
+			/** Spatial velocity of output frame. */
+			::std::vector< ::rl::math::MotionVector, ::Eigen::aligned_allocator< ::rl::math::MotionVector>> v;
+			
+			/** Pluecker transform from input to output frame. */
+			::std::vector< ::rl::math::PlueckerTransform, ::Eigen::aligned_allocator< ::rl::math::PlueckerTransform>> x;
+			
+			/** Position of output frame in world coordinates. */
+			::std::vector< ::rl::math::PlueckerTransform, ::Eigen::aligned_allocator< ::rl::math::PlueckerTransform>> x0;
+			
+		protected:
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_MDL_WORKSPACE_H
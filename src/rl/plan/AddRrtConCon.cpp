@@ -26,6 +26,7 @@
 
 #include "AddRrtConCon.h"
 #include "SimpleModel.h"
+#include "Statistics.h"
 #include "Viewer.h"
 
 namespace rl
@@ -47,6 +48,8 @@ namespace rl
 		Rrt::Vertex
 		AddRrtConCon::addVertex(Tree& tree, const VectorPtr& q)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
 			bundle->index = ::boost::num_vertices(tree) - 1;
 			bundle->q = q;
@@ -90,7 +93,7 @@ namespace rl
 			
 			::rl::math::Vector chosen(this->model->getDofPosition());
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration)
+			while (!this->isTerminated())
 			{
 				for (::std::size_t j = 0; j < 2; ++j)
 				{
@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <rl/kin/Joint.h>
+#include <rl/kin/Kinematics.h>
+#include <rl/kin/Prismatic.h>
+#include <rl/math/Unit.h>
+#include <rl/mdl/Helical.h>
+#include <rl/mdl/Joint.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/Transform.h>
+#include <rl/sg/Body.h>
+#include <rl/sg/ContinuousScene.h>
+#include <rl/sg/Model.h>
+
+#include "ContinuousVerifier.h"
+#include "Exception.h"
+#include "SimpleModel.h"
+#include "Statistics.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ContinuousVerifier::ContinuousVerifier() :
+			Verifier(),
+			tolerance(static_cast< ::rl::math::Real>(0.05)),
+			frames()
+		{
+		}
+		
+		ContinuousVerifier::~ContinuousVerifier()
+		{
+		}
+		
+		::rl::math::Real
+		ContinuousVerifier::getDisplacement(const ::rl::math::Vector& u, const ::rl::math::Vector& v) const
+		{
+			::rl::math::Real reach = 0;
+			
+			for (::std::size_t i = 0; i < this->model->getBodies(); ++i)
+			{
+				::rl::sg::Body* body = this->model->getBody(i);
+				reach = ::std::max(reach, body->max.cwiseAbs().cwiseMax(body->min.cwiseAbs()).norm());
+			}
+			
+			::rl::math::Vector reaches(u.size());
+			
+			if (nullptr != this->model->kin)
+			{
+				// joint i only moves the links following it
+				
+				for (::std::size_t i = this->model->kin->getDof(); i > 0; --i)
+				{
+					::rl::kin::Joint* joint = this->model->kin->getJoint(i - 1);
+					::rl::math::Real d = ::std::abs(joint->d);
+					
+					if (nullptr != dynamic_cast< ::rl::kin::Prismatic*>(joint))
+					{
+						d = ::std::abs(joint->d + joint->offset) + ::std::max(::std::abs(joint->min), ::std::abs(joint->max));
+					}
+					
+					reach += ::std::sqrt(joint->a * joint->a + d * d);
+					reaches(i - 1) = reach;
+				}
+			}
+			else
+			{
+				for (::std::size_t i = 0; i < this->model->mdl->getTransforms(); ++i)
+				{
+					::rl::mdl::Transform* transform = this->model->mdl->getTransform(i);
+					::rl::mdl::Joint* joint = dynamic_cast< ::rl::mdl::Joint*>(transform);
+					
+					if (nullptr == joint)
+					{
+						reach += transform->x.translation().norm();
+					}
+					else
+					{
+						::rl::math::Vector extent = joint->getMaximum().cwiseAbs().cwiseMax(joint->getMinimum().cwiseAbs());
+						
+						for (::std::size_t j = 0; j < joint->getDofPosition(); ++j)
+						{
+							if (::rl::math::UNIT_METER == joint->getPositionUnits()(j))
+							{
+								reach += extent(j);
+							}
+						}
+						
+						if (::rl::mdl::Helical* helical = dynamic_cast< ::rl::mdl::Helical*>(joint))
+						{
+							reach += ::std::abs(helical->getPitch()) * extent(0);
+						}
+					}
+				}
+				
+				reaches.setConstant(reach);
+			}
+			
+			::rl::math::Vector weights(u.size());
+			::Eigen::Matrix< ::rl::math::Unit, ::Eigen::Dynamic, 1> units = this->model->getPositionUnits();
+			
+			for (::std::ptrdiff_t i = 0; i < weights.size(); ++i)
+			{
+				switch (units(i))
+				{
+				case ::rl::math::UNIT_METER:
+					weights(i) = 1;
+					break;
+				case ::rl::math::UNIT_RADIAN:
+					weights(i) = reaches(i);
+					break;
+				default:
+					// quaternion components, a rotation angle is bounded by pi times their change
+					weights(i) = static_cast< ::rl::math::Real>(M_PI) * reaches(i);
+					break;
+				}
+			}
+			
+			if (nullptr != this->model->mdl)
+			{
+				for (::std::size_t i = 0, j = 0; i < this->model->mdl->getJoints(); j += this->model->mdl->getJoint(i)->getDofPosition(), ++i)
+				{
+					if (::rl::mdl::Helical* helical = dynamic_cast< ::rl::mdl::Helical*>(this->model->mdl->getJoint(i)))
+					{
+						weights(j) = reaches(j) + ::std::abs(helical->getPitch());
+					}
+				}
+			}
+			
+			::rl::math::Vector maximum = this->model->getMaximum();
+			::rl::math::Vector minimum = this->model->getMinimum();
+			::Eigen::Matrix<bool, ::Eigen::Dynamic, 1> wraparounds = this->model->getWraparounds();
+			
+			::rl::math::Real displacement = 0;
+			
+			for (::std::ptrdiff_t i = 0; i < u.size(); ++i)
+			{
+				::rl::math::Real diff = ::std::abs(v(i) - u(i));
+				
+				if (wraparounds(i))
+				{
+					diff = ::std::min(diff, ::std::abs(maximum(i) - minimum(i)) - diff);
+				}
+				
+				displacement += weights(i) * diff;
+			}
+			
+			return displacement;
+		}
+		
+		bool
+		ContinuousVerifier::isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d)
+		{
+			assert(u.size() == this->model->getDofPosition());
+			assert(v.size() == this->model->getDofPosition());
+			
+			::rl::sg::ContinuousScene* scene = dynamic_cast< ::rl::sg::ContinuousScene*>(this->model->scene);
+			
+			if (nullptr == scene)
+			{
+				throw Exception("rl::plan::ContinuousVerifier::isColliding() - Scene does not support continuous collision detection");
+			}
+			
+			// a body point moving by at most 2 * tolerance passes within tolerance of its positions at start or end of the segment
+			::std::size_t steps = ::std::max< ::std::size_t>(
+				::std::max< ::std::size_t>(1, this->getSteps(d)),
+				static_cast< ::std::size_t>(::std::ceil(this->getDisplacement(u, v) / (2 * this->tolerance)))
+			);
+			
+			this->model->setPosition(u);
+			this->model->updateFrames();
+			
+			this->frames.resize(this->model->getBodies());
+			
+			::rl::math::Vector inter(u.size());
+			
+			for (::std::size_t i = 0; i < steps; ++i)
+			{
+				Statistics::Timer timer(this->model->statistics, Statistics::PHASE_COLLISION);
+				
+				this->model->interpolate(u, v, static_cast< ::rl::math::Real>(i + 1) / static_cast< ::rl::math::Real>(steps), inter);
+				this->model->setPosition(inter);
+				this->model->updateFrames(false);
+				
+				for (::std::size_t j = 0; j < this->model->getBodies(); ++j)
+				{
+					this->frames[j] = this->model->getFrame(j);
+				}
+				
+				for (::std::size_t j = 0; j < this->model->getBodies(); ++j)
+				{
+					if (this->model->isColliding(j))
+					{
+						for (::rl::sg::Scene::Iterator k = scene->begin(); k != scene->end(); ++k)
+						{
+							if (this->model->model != *k)
+							{
+								for (::rl::sg::Model::Iterator l = (*k)->begin(); l != (*k)->end(); ++l)
+								{
+									::rl::math::Transform frame;
+									(*l)->getFrame(frame);
+									
+									if (scene->areColliding(this->model->getBody(j), this->frames[j], *l, frame))
+									{
+										return true;
+									}
+								}
+							}
+						}
+					}
+					
+					for (::std::size_t k = 0; k < j; ++k)
+					{
+						if (this->model->areColliding(j, k))
+						{
+							if (scene->areColliding(this->model->getBody(j), this->frames[j], this->model->getBody(k), this->frames[k]))
+							{
+								return true;
+							}
+						}
+					}
+				}
+				
+				for (::std::size_t j = 0; j < this->model->getBodies(); ++j)
+				{
+					this->model->getBody(j)->setFrame(this->frames[j]);
+				}
+			}
+			
+			return false;
+		}
+	}
+}
@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_CONTINUOUSVERIFIER_H
+#define RL_PLAN_CONTINUOUSVERIFIER_H
+
+#include <vector>
+#include <rl/math/Transform.h>
+
+#include "Verifier.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Edge verification with continuous collision detection.
+		 * 
+		 * The edge is divided into segments of at most delta in configuration
+		 * space. For every segment, the bodies of the robot are swept along a
+		 * screw motion from their frames at the start of the segment to their
+		 * frames at its end. As this motion differs from the one of the
+		 * kinematic chain, the segments are further refined until no body
+		 * point moves by more than twice the tolerance within a segment.
+		 * 
+		 * The bound is derived from the joint motion, the link lengths of the
+		 * kinematic model, and the bounding boxes of the bodies, so the scene
+		 * should be loaded with bounding box points. A body point moving by at
+		 * most 2 * tolerance within a segment passes within tolerance of its
+		 * position at the start or at the end of the segment, both covered by
+		 * the sweep. Obstacles containing a ball of radius tolerance around a
+		 * point passed by the robot are therefore not missed, thinner
+		 * obstacles are detected as far as the screw motion crosses them.
+		 * 
+		 * Each segment is recorded as one collision query in the statistics
+		 * of the model. With the default tolerance of 0.05, an edge of the
+		 * Unimation Puma 560 requires fewer segments than a RecursiveVerifier
+		 * with a delta of one degree requires configurations.
+		 * 
+		 * Requires a scene implementing rl::sg::ContinuousScene.
+		 */
+		class RL_PLAN_EXPORT ContinuousVerifier : public Verifier
+		{
+		public:
+			ContinuousVerifier();
+			
+			virtual ~ContinuousVerifier();
+			
+			using Verifier::isColliding;
+			
+			bool isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d);
+			
+			/** Maximum deviation between swept and actual body motion. */
+			::rl::math::Real tolerance;
+			
+		protected:
+			
+		private:
+			/**
+			 * Bound on the displacement of any body point between two
+			 * configurations.
+			 * 
+			 * Rotations are weighted with the maximum distance between a joint
+			 * axis and a body point, which is bounded by the sum of the lengths
+			 * of the links moved by the joint, or of all links for a
+			 * rl::mdl::Kinematic, and the largest body radius.
+			 */
+			::rl::math::Real getDisplacement(const ::rl::math::Vector& u, const ::rl::math::Vector& v) const;
+			
+			::std::vector< ::rl::math::Transform, ::Eigen::aligned_allocator< ::rl::math::Transform>> frames;
+		};
+	}
+}
+
+#endif // RL_PLAN_CONTINUOUSVERIFIER_H
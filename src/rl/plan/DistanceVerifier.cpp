@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <rl/sg/DistanceScene.h>
+#include <rl/sg/Model.h>
+
+#include "DistanceVerifier.h"
+#include "Exception.h"
+#include "SimpleModel.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		DistanceVerifier::DistanceVerifier() :
+			Verifier(),
+			radius(0)
+		{
+		}
+		
+		DistanceVerifier::~DistanceVerifier()
+		{
+		}
+		
+		bool
+		DistanceVerifier::isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d)
+		{
+			assert(u.size() == this->model->getDofPosition());
+			assert(v.size() == this->model->getDofPosition());
+			
+			SimpleModel* model = this->model;
+			::rl::sg::DistanceScene* scene = dynamic_cast< ::rl::sg::DistanceScene*>(model->scene);
+			
+			if (nullptr == scene)
+			{
+				throw Exception("rl::plan::DistanceVerifier::isColliding() - Scene does not support distance queries");
+			}
+			
+			if (model->getBodies() != model->getDofPosition() + 1)
+			{
+				throw Exception("rl::plan::DistanceVerifier::isColliding() - Model is not a serial chain");
+			}
+			
+			model->setPosition(u);
+			model->updateFrames();
+			
+			// maximum distance of moved bodies from joint
+			
+			::Eigen::Matrix< ::rl::math::Unit, ::Eigen::Dynamic, 1> units = model->getPositionUnits();
+			::rl::math::Vector maximum = model->getMaximum();
+			::rl::math::Vector minimum = model->getMinimum();
+			::Eigen::Matrix<bool, ::Eigen::Dynamic, 1> wraparounds = model->getWraparounds();
+			
+			::rl::math::Vector lengths(u.size());
+			
+			for (::std::size_t i = 0; i < model->getDofPosition(); ++i)
+			{
+				lengths(i) = (model->getFrame(i + 1).translation() - model->getFrame(i).translation()).norm();
+				
+				if (::rl::math::UNIT_METER == units(i))
+				{
+					lengths(i) += ::std::abs(maximum(i) - minimum(i));
+				}
+			}
+			
+			// upper bound of workspace displacement along edge
+			
+			::rl::math::Real bound = 0;
+			::rl::math::Real reach = this->radius;
+			
+			for (::std::size_t i = model->getDofPosition(); i > 0; --i)
+			{
+				reach += lengths(i - 1);
+				
+				::rl::math::Real delta = ::std::abs(v(i - 1) - u(i - 1));
+				
+				if (wraparounds(i - 1))
+				{
+					delta = ::std::min(delta, ::std::abs(::std::abs(maximum(i - 1) - minimum(i - 1)) - delta));
+				}
+				
+				bound += delta * (::rl::math::UNIT_METER == units(i - 1) ? 1 : reach);
+			}
+			
+			if (bound <= 0)
+			{
+				return false;
+			}
+			
+			::std::size_t steps = ::std::max< ::std::size_t>(1, this->getSteps(d));
+			::rl::math::Real step = static_cast< ::rl::math::Real>(1) / static_cast< ::rl::math::Real>(steps);
+			
+			::rl::math::Vector inter(u.size());
+			::rl::math::Vector3 point1;
+			::rl::math::Vector3 point2;
+			
+			for (::rl::math::Real alpha = 0; ; )
+			{
+				// obstacles are static, both bodies of a pair of the robot move
+				
+				::rl::math::Real obstacles = ::std::numeric_limits< ::rl::math::Real>::max();
+				::rl::math::Real self = ::std::numeric_limits< ::rl::math::Real>::max();
+				
+				for (::std::size_t i = 0; i < model->getBodies(); ++i)
+				{
+					if (model->isColliding(i))
+					{
+						for (::rl::sg::Scene::Iterator j = scene->begin(); j != scene->end(); ++j)
+						{
+							if (model->model != *j)
+							{
+								for (::rl::sg::Model::Iterator k = (*j)->begin(); k != (*j)->end(); ++k)
+								{
+									obstacles = ::std::min(obstacles, scene->distance(model->model->getBody(i), *k, point1, point2));
+								}
+							}
+						}
+					}
+					
+					for (::std::size_t j = 0; j < i; ++j)
+					{
+						if (model->areColliding(i, j))
+						{
+							self = ::std::min(self, scene->distance(model->model->getBody(i), model->model->getBody(j), point1, point2));
+						}
+					}
+				}
+				
+				if (obstacles <= 0 || self <= 0)
+				{
+					return true;
+				}
+				
+				::rl::math::Real free = ::std::min(obstacles / bound, self / (2 * bound));
+				
+				if (free < step && model->isColliding())
+				{
+					return true;
+				}
+				
+				alpha += ::std::max(free, step);
+				
+				if (alpha >= 1)
+				{
+					break;
+				}
+				
+				model->interpolate(u, v, alpha, inter);
+				model->setPosition(inter);
+				model->updateFrames();
+			}
+			
+			return false;
+		}
+	}
+}
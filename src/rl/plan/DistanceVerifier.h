@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_DISTANCEVERIFIER_H
+#define RL_PLAN_DISTANCEVERIFIER_H
+
+#include "Verifier.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Edge verification with clearance-based adaptive steps.
+		 * 
+		 * At each visited configuration, the minimum distances of the robot to
+		 * obstacles and to itself are computed. The displacement of any point
+		 * of the robot is bounded by the sum of the joint motions weighted with
+		 * the distance of the moved bodies from the joint, derived from the
+		 * lengths of the links between consecutive body frames. As both bodies
+		 * of a self-collision pair move, their distance may shrink by twice
+		 * this bound. The verification advances along the edge by the fraction
+		 * that is certified to be free and falls back to steps of delta near
+		 * obstacles.
+		 * 
+		 * Requires a model of a serial chain, where body i + 1 is moved by
+		 * joint i, in a scene implementing rl::sg::DistanceScene.
+		 * 
+		 * Fabian Schwarzer, Mitul Saha, and Jean-Claude Latombe. Exact
+		 * collision checking of robot paths. In Algorithmic Foundations of
+		 * Robotics V, pages 25-41. Springer, 2004.
+		 */
+		class RL_PLAN_EXPORT DistanceVerifier : public Verifier
+		{
+		public:
+			DistanceVerifier();
+			
+			virtual ~DistanceVerifier();
+			
+			using Verifier::isColliding;
+			
+			bool isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d);
+			
+			/**
+			 * Upper bound for the distance of the geometry of a body from the
+			 * origin of its frame.
+			 * 
+			 * Added to the link lengths of the kinematic chain, needs to cover
+			 * geometry extending beyond the next body frame, e.g., of the last
+			 * body of the robot.
+			 */
+			::rl::math::Real radius;
+			
+		protected:
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_PLAN_DISTANCEVERIFIER_H
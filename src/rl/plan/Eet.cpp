@@ -34,6 +34,7 @@
 #include "Exception.h"
 #include "Sampler.h"
 #include "SimpleModel.h"
+#include "Statistics.h"
 #include "Viewer.h"
 #include "WorkspaceSphereExplorer.h"
 #include "WorkspaceSphereVector.h"
@@ -80,6 +81,8 @@ namespace rl
 		Rrt::Edge
 		Eet::addEdge(const Vertex& u, const Vertex& v, Tree& tree)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			Edge e = ::boost::add_edge(u, v, tree).first;
 			
 			if (nullptr != this->viewer)
@@ -93,6 +96,8 @@ namespace rl
 		Eet::Vertex
 		Eet::addVertex(Tree& tree, const VectorPtr& q)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
 			bundle->index = ::boost::num_vertices(tree) - 1;
 			bundle->q = q;
@@ -294,6 +299,7 @@ namespace rl
 		Rrt::Neighbor
 		Eet::nearest(const Tree& tree, const ::rl::math::Transform& chosen)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_NEAREST);
 			::std::vector< ::rl::math::GnatNearestNeighbors<WorkspaceMetric>::Neighbor> neighbors = this->nn.nearest(WorkspaceMetric::Value(&chosen, Vertex()), 1);
 			return Neighbor(neighbors.front().first, neighbors.front().second.second);
 		}
@@ -407,7 +413,7 @@ namespace rl
 			WorkspaceSphereVector::iterator i = ++path.begin();
 			::rl::math::Real sigma = gamma; // initialize exploration/exploitation balance
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration) // search until goal reached
+			while (!this->isTerminated()) // search until goal reached
 			{
 				if (sigma < 1) // sample is within current sphere
 				{
@@ -84,11 +84,21 @@ namespace rl
 			}
 		}
 		
+		void
+		GaussianSampler::generateCollisionFree(::rl::math::Matrix& q)
+		{
+			for (::std::ptrdiff_t i = 0; i < q.cols(); ++i)
+			{
+				q.col(i) = this->generateCollisionFree();
+			}
+		}
+		
 		void
 		GaussianSampler::seed(const ::std::mt19937::result_type& value)
 		{
 			this->gaussEngine.seed(value);
 			this->randEngine.seed(value);
+			this->surplus.clear();
 		}
 	}
 }
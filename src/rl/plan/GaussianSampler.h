@@ -52,6 +52,11 @@ namespace rl
 			
 			::rl::math::Vector generateCollisionFree();
 			
+			/**
+			 * Fill columns of a matrix with configurations of generateCollisionFree().
+			 */
+			void generateCollisionFree(::rl::math::Matrix& q);
+			
 			virtual void seed(const ::std::mt19937::result_type& value);
 			
 			::rl::math::Vector* sigma;
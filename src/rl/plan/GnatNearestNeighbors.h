@@ -58,10 +58,14 @@ namespace rl
 			
 			::std::size_t getNodeDegreeMin() const;
 			
+			using NearestNeighbors::nearest;
+			
 			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
 			
 			void push(const NearestNeighbors::Value& value);
 			
+			using NearestNeighbors::radius;
+			
 			::std::vector<NearestNeighbors::Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const;
 			
 			void seed(const ::std::mt19937::result_type& value);
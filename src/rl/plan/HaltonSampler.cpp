@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <numeric>
+
+#include "HaltonSampler.h"
+#include "SimpleModel.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		HaltonSampler::HaltonSampler() :
+			Sampler(),
+			scrambled(true),
+			randEngine(::std::random_device()()),
+			index(0),
+			permutations(),
+			primes()
+		{
+		}
+		
+		HaltonSampler::~HaltonSampler()
+		{
+		}
+		
+		::rl::math::Vector
+		HaltonSampler::generate()
+		{
+			for (::std::size_t i = this->primes.empty() ? 2 : this->primes.back() + 1; this->primes.size() < this->model->getDof(); ++i)
+			{
+				if (::std::none_of(this->primes.begin(), this->primes.end(), [i](const ::std::size_t& prime) { return 0 == i % prime; }))
+				{
+					this->primes.push_back(i);
+				}
+			}
+			
+			// digit permutations keep zero fixed
+			
+			while (this->permutations.size() < this->model->getDof())
+			{
+				::std::vector< ::std::size_t> permutation(this->primes[this->permutations.size()]);
+				::std::iota(permutation.begin(), permutation.end(), 0);
+				::std::shuffle(permutation.begin() + 1, permutation.end(), this->randEngine);
+				this->permutations.push_back(permutation);
+			}
+			
+			++this->index;
+			
+			::rl::math::Vector rand(this->model->getDof());
+			
+			for (::std::size_t i = 0; i < this->model->getDof(); ++i)
+			{
+				::rl::math::Real base = static_cast< ::rl::math::Real>(this->primes[i]);
+				::rl::math::Real factor = 1 / base;
+				rand(i) = 0;
+				
+				for (::std::size_t j = this->index; j > 0; j /= this->primes[i])
+				{
+					::std::size_t digit = j % this->primes[i];
+					rand(i) += (this->scrambled ? this->permutations[i][digit] : digit) * factor;
+					factor /= base;
+				}
+			}
+			
+			return this->model->generatePositionUniform(rand);
+		}
+		
+		void
+		HaltonSampler::seed(const ::std::mt19937::result_type& value)
+		{
+			this->randEngine.seed(value);
+			this->index = 0;
+			this->permutations.clear();
+			this->surplus.clear();
+		}
+	}
+}
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_HALTONSAMPLER_H
+#define RL_PLAN_HALTONSAMPLER_H
+
+#include <random>
+#include <vector>
+
+#include "Sampler.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Halton sequence sampling strategy.
+		 * 
+		 * Deterministic low-discrepancy sequence using the radical inverse
+		 * with the i-th prime as base for the i-th joint. Scrambling applies
+		 * random permutations to the digits of each base, avoiding the
+		 * correlation between joints with large bases.
+		 * 
+		 * Ladislav Kocis and William J. Whiten. Computational investigations
+		 * of low-discrepancy sequences. ACM Transactions on Mathematical
+		 * Software, 23(2):266-294, June 1997.
+		 * 
+		 * http://dx.doi.org/10.1145/264029.264064
+		 */
+		class RL_PLAN_EXPORT HaltonSampler : public Sampler
+		{
+		public:
+			HaltonSampler();
+			
+			virtual ~HaltonSampler();
+			
+			::rl::math::Vector generate();
+			
+			/**
+			 * Restart sequence and choose new digit permutations.
+			 */
+			virtual void seed(const ::std::mt19937::result_type& value);
+			
+			/** Use scrambled Halton sequence. */
+			bool scrambled;
+			
+		protected:
+			::std::mt19937 randEngine;
+			
+		private:
+			::std::size_t index;
+			
+			::std::vector< ::std::vector< ::std::size_t>> permutations;
+			
+			::std::vector< ::std::size_t> primes;
+		};
+	}
+}
+
+#endif // RL_PLAN_HALTONSAMPLER_H
@@ -52,10 +52,14 @@ namespace rl
 			
 			::std::size_t getNodeDataMax() const;
 			
+			using NearestNeighbors::nearest;
+			
 			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
 			
 			void push(const NearestNeighbors::Value& value);
 			
+			using NearestNeighbors::radius;
+			
 			::std::vector<NearestNeighbors::Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const;
 			
 			void setChecks(const ::boost::optional< ::std::size_t>& checks);
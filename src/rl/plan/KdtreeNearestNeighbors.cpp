@@ -53,6 +53,12 @@ namespace rl
 			return this->container.empty();
 		}
 		
+		::boost::optional<double>
+		KdtreeNearestNeighbors::getBalance() const
+		{
+			return this->container.getBalance();
+		}
+		
 		::boost::optional< ::std::size_t>
 		KdtreeNearestNeighbors::getChecks() const
 		{
@@ -83,6 +89,12 @@ namespace rl
 			return this->container.radius(query, radius, sorted);
 		}
 		
+		void
+		KdtreeNearestNeighbors::setBalance(const ::boost::optional<double>& balance)
+		{
+			this->container.setBalance(balance);
+		}
+		
 		void
 		KdtreeNearestNeighbors::setChecks(const ::boost::optional< ::std::size_t>& checks)
 		{
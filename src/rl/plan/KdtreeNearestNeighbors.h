@@ -48,16 +48,24 @@ namespace rl
 			
 			bool empty() const;
 			
+			::boost::optional<double> getBalance() const;
+			
 			::boost::optional< ::std::size_t> getChecks() const;
 			
 			::std::size_t getSamples() const;
 			
+			using NearestNeighbors::nearest;
+			
 			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
 			
 			void push(const NearestNeighbors::Value& value);
 			
+			using NearestNeighbors::radius;
+			
 			::std::vector<NearestNeighbors::Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const;
 			
+			void setBalance(const ::boost::optional<double>& balance);
+			
 			void setChecks(const ::boost::optional< ::std::size_t>& checks);
 			
 			void setSamples(const ::std::size_t& samples);
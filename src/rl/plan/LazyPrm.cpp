@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <boost/graph/incremental_components.hpp>
+
+#include "LazyPrm.h"
+#include "Sampler.h"
+#include "SimpleModel.h"
+#include "Statistics.h"
+#include "Verifier.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		LazyPrm::LazyPrm() :
+			Prm()
+		{
+		}
+		
+		LazyPrm::~LazyPrm()
+		{
+		}
+		
+		::std::string
+		LazyPrm::getName() const
+		{
+			return "Lazy PRM";
+		}
+		
+		void
+		LazyPrm::insert(const Vertex& v)
+		{
+			::std::vector<Neighbor> neighbors;
+			
+			{
+				Statistics::Timer timer(this->statistics, Statistics::PHASE_NEAREST);
+				neighbors = this->graph[::boost::graph_bundle].nn->nearest(Metric::Value(this->graph[v].q.get(), v), this->k);
+			}
+			
+			for (::std::size_t i = 0; i < neighbors.size() && ::boost::degree(v, this->graph) < this->degree; ++i)
+			{
+				Vertex u = neighbors[i].second.second;
+				
+				if (::boost::degree(u, this->graph) < this->degree)
+				{
+					::rl::math::Real d = this->graph[::boost::graph_bundle].nn->isTransformedDistance() ? this->model->inverseOfTransformedDistance(neighbors[i].first) : neighbors[i].first;
+					
+					if (d < this->radius)
+					{
+						Edge e = this->addEdge(u, v, d);
+						this->graph[e].verified = false;
+					}
+				}
+			}
+			
+			this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[v].q.get(), v));
+		}
+		
+		bool
+		LazyPrm::solve()
+		{
+			this->time = ::std::chrono::steady_clock::now();
+			
+			this->begin = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->start));
+			this->insert(this->begin);
+			
+			this->end = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->goal));
+			this->insert(this->end);
+			
+			while (!this->isTerminated())
+			{
+				if (!::boost::same_component(this->begin, this->end, this->ds))
+				{
+					this->construct(::std::max< ::std::size_t>(1, this->sampler->models.size()));
+					continue;
+				}
+				
+				this->search();
+				
+				bool colliding = false;
+				
+				for (Vertex v = this->end; v != this->begin; v = this->graph[v].predecessor)
+				{
+					Vertex u = this->graph[v].predecessor;
+					Edge e = ::boost::edge(u, v, this->graph).first;
+					
+					if (!this->graph[e].verified)
+					{
+						Statistics::Timer timer(this->statistics, Statistics::PHASE_VERIFICATION);
+						
+						if (this->verifier->isColliding(*this->graph[u].q, *this->graph[v].q, this->graph[e].weight))
+						{
+							::boost::remove_edge(e, this->graph);
+							colliding = true;
+							break;
+						}
+						
+						this->graph[e].verified = true;
+					}
+				}
+				
+				if (!colliding)
+				{
+					return true;
+				}
+				
+				this->updateComponents();
+			}
+			
+			return false;
+		}
+		
+		void
+		LazyPrm::updateComponents()
+		{
+			for (VertexIteratorPair i = ::boost::vertices(this->graph); i.first != i.second; ++i.first)
+			{
+				this->ds.make_set(*i.first);
+			}
+			
+			for (EdgeIteratorPair i = ::boost::edges(this->graph); i.first != i.second; ++i.first)
+			{
+				this->ds.union_set(::boost::source(*i.first, this->graph), ::boost::target(*i.first, this->graph));
+			}
+		}
+	}
+}
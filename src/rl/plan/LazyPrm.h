@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_LAZYPRM_H
+#define RL_PLAN_LAZYPRM_H
+
+#include "Prm.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Lazy Probabilistic Roadmaps.
+		 * 
+		 * Edges to neighbors are inserted without collision checks. Edges
+		 * are only verified once they are part of a shortest path between
+		 * start and goal, colliding edges are removed and the search is
+		 * repeated.
+		 * 
+		 * Robert Bohlin and Lydia E. Kavraki. Path planning using lazy PRM. In
+		 * Proceedings of the IEEE International Conference on Robotics and
+		 * Automation, pages 521-528, San Francisco, CA, USA, April 2000.
+		 * 
+		 * http://dx.doi.org/10.1109/ROBOT.2000.844107
+		 */
+		class RL_PLAN_EXPORT LazyPrm : public Prm
+		{
+		public:
+			LazyPrm();
+			
+			virtual ~LazyPrm();
+			
+			::std::string getName() const;
+			
+			bool solve();
+			
+		protected:
+			void insert(const Vertex& v);
+			
+			/**
+			 * Rebuild connected components after removal of edges.
+			 */
+			void updateComponents();
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_PLAN_LAZYPRM_H
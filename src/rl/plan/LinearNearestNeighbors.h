@@ -48,8 +48,12 @@ namespace rl
 			
 			bool empty() const;
 			
+			using NearestNeighbors::nearest;
+			
 			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
 			
+			using NearestNeighbors::radius;
+			
 			::std::vector<NearestNeighbors::Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const;
 			
 			void push(const NearestNeighbors::Value& value);
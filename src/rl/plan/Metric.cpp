@@ -24,6 +24,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cmath>
+#include <rl/kin/Kinematics.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/Prismatic.h>
+#include <rl/mdl/Revolute.h>
+
 #include "Metric.h"
 #include "Model.h"
 
@@ -32,9 +38,81 @@ namespace rl
 	namespace plan
 	{
 		Metric::Metric(Model* model, const bool& transformed) :
+			fixed(false),
 			model(model),
-			transformed(transformed)
+			ranges(),
+			transformed(transformed),
+			transformedDistance(&Metric::TransformedDistance)
 		{
+			if (nullptr != this->model && nullptr != this->model->kin)
+			{
+				this->fixed = true;
+				
+				::rl::math::Vector maximum(this->model->kin->getDof());
+				this->model->kin->getMaximum(maximum);
+				::rl::math::Vector minimum(this->model->kin->getDof());
+				this->model->kin->getMinimum(minimum);
+				::Eigen::Matrix<bool, ::Eigen::Dynamic, 1> wraparounds(this->model->kin->getDof());
+				this->model->kin->getWraparounds(wraparounds);
+				
+				this->ranges = wraparounds.select((maximum - minimum).cwiseAbs(), ::rl::math::Vector::Zero(wraparounds.size()));
+			}
+			else if (nullptr != this->model && nullptr != this->model->mdl && this->model->mdl->getDof() == this->model->mdl->getDofPosition())
+			{
+				this->fixed = true;
+				this->ranges = ::rl::math::Vector::Zero(this->model->mdl->getDofPosition());
+				
+				for (::std::size_t i = 0; i < this->model->mdl->getJoints(); ++i)
+				{
+					::rl::mdl::Joint* joint = this->model->mdl->getJoint(i);
+					
+					if (nullptr != dynamic_cast< ::rl::mdl::Revolute*>(joint))
+					{
+						if (joint->wraparound(0))
+						{
+							this->ranges(i) = ::std::abs(joint->max(0) - joint->min(0));
+						}
+					}
+					else if (nullptr == dynamic_cast< ::rl::mdl::Prismatic*>(joint))
+					{
+						this->fixed = false;
+					}
+				}
+			}
+			
+			if (this->fixed)
+			{
+				switch (this->ranges.size())
+				{
+				case 1:
+					this->transformedDistance = &Metric::TransformedDistance<1>;
+					break;
+				case 2:
+					this->transformedDistance = &Metric::TransformedDistance<2>;
+					break;
+				case 3:
+					this->transformedDistance = &Metric::TransformedDistance<3>;
+					break;
+				case 4:
+					this->transformedDistance = &Metric::TransformedDistance<4>;
+					break;
+				case 5:
+					this->transformedDistance = &Metric::TransformedDistance<5>;
+					break;
+				case 6:
+					this->transformedDistance = &Metric::TransformedDistance<6>;
+					break;
+				case 7:
+					this->transformedDistance = &Metric::TransformedDistance<7>;
+					break;
+				case 8:
+					this->transformedDistance = &Metric::TransformedDistance<8>;
+					break;
+				default:
+					this->transformedDistance = &Metric::TransformedDistance<::Eigen::Dynamic>;
+					break;
+				}
+			}
 		}
 		
 		Metric::~Metric()
@@ -46,7 +124,11 @@ namespace rl
 		{
 			if (this->transformed)
 			{
-				return this->model->transformedDistance(*lhs.first, *rhs.first);
+				return this->transformedDistance(*this, lhs, rhs);
+			}
+			else if (this->fixed)
+			{
+				return ::std::sqrt(this->transformedDistance(*this, lhs, rhs));
 			}
 			else
 			{
@@ -57,7 +139,38 @@ namespace rl
 		Metric::Distance
 		Metric::operator()(const Distance& lhs, const Distance& rhs, const ::std::size_t& index) const
 		{
-			return this->model->transformedDistance(lhs, rhs, index);
+			if (this->fixed)
+			{
+				Distance delta = ::std::abs(lhs - rhs);
+				
+				if (this->ranges(index) > 0)
+				{
+					delta = ::std::max(delta, ::std::abs(this->ranges(index) - delta));
+				}
+				
+				return delta * delta;
+			}
+			else
+			{
+				return this->model->transformedDistance(lhs, rhs, index);
+			}
+		}
+		
+		Metric::Distance
+		Metric::TransformedDistance(const Metric& metric, const Value& lhs, const Value& rhs)
+		{
+			return metric.model->transformedDistance(*lhs.first, *rhs.first);
+		}
+		
+		template<int Dof>
+		Metric::Distance
+		Metric::TransformedDistance(const Metric& metric, const Value& lhs, const Value& rhs)
+		{
+			::Eigen::Map<const ::Eigen::Array<Distance, Dof, 1>> q1(lhs.first->data(), metric.ranges.size());
+			::Eigen::Map<const ::Eigen::Array<Distance, Dof, 1>> q2(rhs.first->data(), metric.ranges.size());
+			::Eigen::Map<const ::Eigen::Array<Distance, Dof, 1>> ranges(metric.ranges.data(), metric.ranges.size());
+			::Eigen::Array<Distance, Dof, 1> delta = (q2 - q1).abs();
+			return (ranges > 0).select(delta.min((ranges - delta).abs()), delta).square().sum();
 		}
 		
 		Metric::Value::Value() :
@@ -37,6 +37,14 @@ namespace rl
 	{
 		class Model;
 		
+		/**
+		 * Configuration space metric of a model.
+		 * 
+		 * For models with up to eight revolute or prismatic joints, distances
+		 * are computed with fixed-size vectors and the wraparound ranges
+		 * cached on construction, without virtual calls to the model.
+		 * Other models use the distance functions of the model.
+		 */
 		class RL_PLAN_EXPORT Metric
 		{
 		public:
@@ -74,9 +82,20 @@ namespace rl
 		protected:
 			
 		private:
+			static Distance TransformedDistance(const Metric& metric, const Value& lhs, const Value& rhs);
+			
+			template<int Dof>
+			static Distance TransformedDistance(const Metric& metric, const Value& lhs, const Value& rhs);
+			
+			bool fixed;
+			
 			Model* model;
 			
+			::rl::math::Vector ranges;
+			
 			bool transformed;
+			
+			Distance (*transformedDistance)(const Metric& metric, const Value& lhs, const Value& rhs);
 		};
 	}
 }
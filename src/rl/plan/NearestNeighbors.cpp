@@ -24,6 +24,10 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+
 #include "NearestNeighbors.h"
 
 namespace rl
@@ -31,6 +35,7 @@ namespace rl
 	namespace plan
 	{
 		NearestNeighbors::NearestNeighbors(const bool& transformed) :
+			numThreads(::std::max< ::std::size_t>(1, ::std::thread::hardware_concurrency())),
 			transformed(transformed)
 		{
 		}
@@ -39,10 +44,134 @@ namespace rl
 		{
 		}
 		
+		::std::size_t
+		NearestNeighbors::getNumThreads() const
+		{
+			return this->numThreads;
+		}
+		
 		bool
 		NearestNeighbors::isTransformedDistance() const
 		{
 			return this->transformed;
 		}
+		
+		void
+		NearestNeighbors::nearest(const ::std::vector<Value>& queries, const ::std::size_t& k, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted) const
+		{
+			this->search(queries, &k, nullptr, neighbors, offsets, sorted);
+		}
+		
+		void
+		NearestNeighbors::radius(const ::std::vector<Value>& queries, const Distance& radius, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted) const
+		{
+			this->search(queries, nullptr, &radius, neighbors, offsets, sorted);
+		}
+		
+		void
+		NearestNeighbors::search(const ::std::vector<Value>& queries, const ::std::size_t* k, const Distance* radius, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted) const
+		{
+			offsets.assign(queries.size() + 1, 0);
+			
+			if (queries.empty())
+			{
+				neighbors.clear();
+				return;
+			}
+			
+			::std::size_t threads = ::std::min(this->numThreads, queries.size());
+			
+			// k nearest neighbors fit into fixed slots of caller output, compacted afterwards
+			::std::size_t slot = nullptr != k ? ::std::min(*k, this->size()) : 0;
+			
+			if (nullptr != k)
+			{
+				neighbors.resize(queries.size() * slot);
+			}
+			
+			// neighbors within radius of each contiguous range of queries
+			::std::vector< ::std::vector<Neighbor>> results(nullptr != k ? 0 : threads);
+			
+			::std::function<void(const ::std::size_t&)> worker = [&](const ::std::size_t& thread)
+			{
+				::std::size_t begin = thread * queries.size() / threads;
+				::std::size_t end = (thread + 1) * queries.size() / threads;
+				
+				for (::std::size_t i = begin; i < end; ++i)
+				{
+					if (nullptr != k)
+					{
+						// limit to slot in case of values pushed concurrently during search
+						::std::vector<Neighbor> result = this->nearest(queries[i], *k, sorted);
+						::std::size_t count = ::std::min(result.size(), slot);
+						::std::copy(result.begin(), result.begin() + count, neighbors.begin() + i * slot);
+						offsets[i + 1] = count;
+					}
+					else
+					{
+						::std::vector<Neighbor> result = this->radius(queries[i], *radius, sorted);
+						results[thread].insert(results[thread].end(), result.begin(), result.end());
+						offsets[i + 1] = result.size();
+					}
+				}
+			};
+			
+			if (threads > 1)
+			{
+				::std::vector< ::std::thread> workers;
+				workers.reserve(threads - 1);
+				
+				for (::std::size_t i = 1; i < threads; ++i)
+				{
+					workers.emplace_back(worker, i);
+				}
+				
+				worker(0);
+				
+				for (::std::size_t i = 0; i < workers.size(); ++i)
+				{
+					workers[i].join();
+				}
+			}
+			else
+			{
+				worker(0);
+			}
+			
+			for (::std::size_t i = 0; i < queries.size(); ++i)
+			{
+				offsets[i + 1] += offsets[i];
+			}
+			
+			if (nullptr != k)
+			{
+				for (::std::size_t i = 1; i < queries.size(); ++i)
+				{
+					if (offsets[i] == i * slot)
+					{
+						continue;
+					}
+					
+					::std::copy(neighbors.begin() + i * slot, neighbors.begin() + i * slot + (offsets[i + 1] - offsets[i]), neighbors.begin() + offsets[i]);
+				}
+				
+				neighbors.resize(offsets.back());
+			}
+			else
+			{
+				neighbors.resize(offsets.back());
+				
+				for (::std::size_t i = 0; i < threads; ++i)
+				{
+					::std::copy(results[i].begin(), results[i].end(), neighbors.begin() + offsets[i * queries.size() / threads]);
+				}
+			}
+		}
+		
+		void
+		NearestNeighbors::setNumThreads(const ::std::size_t& numThreads)
+		{
+			this->numThreads = ::std::max< ::std::size_t>(1, numThreads);
+		}
 	}
 }
@@ -55,19 +55,54 @@ namespace rl
 			
 			virtual bool empty() const = 0;
 			
+			/** Number of threads used for batch queries. */
+			::std::size_t getNumThreads() const;
+			
 			bool isTransformedDistance() const;
 			
 			virtual ::std::vector<Neighbor> nearest(const Value& query, const ::std::size_t& k, const bool& sorted = true) const = 0;
 			
+			/**
+			 * Search k nearest neighbors of a batch of queries in parallel.
+			 * 
+			 * Neighbors of query i are stored in neighbors[offsets[i]] to
+			 * neighbors[offsets[i + 1] - 1]. Both buffers are overwritten and
+			 * may be reused between calls to avoid reallocation. Queries are
+			 * distributed over at most getNumThreads() threads.
+			 * 
+			 * @param[out] neighbors Flat buffer of neighbors of all queries
+			 * @param[out] offsets Offsets into neighbors, queries.size() + 1 entries
+			 */
+			virtual void nearest(const ::std::vector<Value>& queries, const ::std::size_t& k, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted = true) const;
+			
 			virtual void push(const Value& value) = 0;
 			
 			virtual ::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const = 0;
 			
+			/**
+			 * Search neighbors within radius of a batch of queries in parallel.
+			 * 
+			 * @see nearest(const ::std::vector<Value>&, const ::std::size_t&, ::std::vector<Neighbor>&, ::std::vector< ::std::size_t>&, const bool&) const
+			 */
+			virtual void radius(const ::std::vector<Value>& queries, const Distance& radius, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted = true) const;
+			
+			/**
+			 * Set number of threads used for batch queries.
+			 * 
+			 * Defaults to the number of hardware threads, 1 runs all queries
+			 * on the calling thread.
+			 */
+			void setNumThreads(const ::std::size_t& numThreads);
+			
 			virtual ::std::size_t size() const = 0;
 			
 		protected:
 			
 		private:
+			void search(const ::std::vector<Value>& queries, const ::std::size_t* k, const Distance* radius, ::std::vector<Neighbor>& neighbors, ::std::vector< ::std::size_t>& offsets, const bool& sorted) const;
+			
+			::std::size_t numThreads;
+			
 			bool transformed;
 		};
 	}
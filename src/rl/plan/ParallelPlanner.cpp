@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "Exception.h"
+#include "ParallelPlanner.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ParallelPlanner::ParallelPlanner() :
+			Planner(),
+			planners(),
+			solver(nullptr)
+		{
+		}
+		
+		ParallelPlanner::~ParallelPlanner()
+		{
+		}
+		
+		::std::string
+		ParallelPlanner::getName() const
+		{
+			return "Parallel";
+		}
+		
+		VectorList
+		ParallelPlanner::getPath()
+		{
+			if (nullptr == this->solver)
+			{
+				throw Exception("rl::plan::ParallelPlanner::getPath() - No solution found");
+			}
+			
+			return this->solver->getPath();
+		}
+		
+		Planner*
+		ParallelPlanner::getSolver() const
+		{
+			return this->solver;
+		}
+		
+		void
+		ParallelPlanner::reset()
+		{
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				this->planners[i]->reset();
+			}
+			
+			this->solver = nullptr;
+		}
+		
+		bool
+		ParallelPlanner::solve()
+		{
+			this->time = ::std::chrono::steady_clock::now();
+			
+			this->solver = nullptr;
+			
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				this->planners[i]->canceled = false;
+				this->planners[i]->duration = this->duration;
+				this->planners[i]->goal = this->goal;
+				this->planners[i]->start = this->start;
+			}
+			
+			::std::atomic< ::std::size_t> finished(0);
+			::std::mutex mutex;
+			::std::vector< ::std::thread> threads;
+			threads.reserve(this->planners.size());
+			
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				threads.push_back(::std::thread([this, &finished, &mutex, i]() {
+					if (this->planners[i]->solve())
+					{
+						::std::lock_guard< ::std::mutex> lock(mutex);
+						
+						if (nullptr == this->solver)
+						{
+							this->solver = this->planners[i];
+							
+							// terminate remaining planners
+							for (::std::size_t j = 0; j < this->planners.size(); ++j)
+							{
+								if (j != i)
+								{
+									this->planners[j]->canceled = true;
+								}
+							}
+						}
+					}
+					
+					++finished;
+				}));
+			}
+			
+			// forward cancellation of this planner to all running planners
+			while (finished < threads.size())
+			{
+				if (this->canceled)
+				{
+					for (::std::size_t i = 0; i < this->planners.size(); ++i)
+					{
+						this->planners[i]->canceled = true;
+					}
+					
+					break;
+				}
+				
+				::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+			}
+			
+			for (::std::size_t i = 0; i < threads.size(); ++i)
+			{
+				threads[i].join();
+			}
+			
+			return nullptr != this->solver;
+		}
+	}
+}
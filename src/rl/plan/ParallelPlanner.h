@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_PARALLELPLANNER_H
+#define RL_PLAN_PARALLELPLANNER_H
+
+#include <vector>
+
+#include "Planner.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * OR-parallel planning with independent workers.
+		 * 
+		 * Runs every planner in its own thread on the same start and goal
+		 * configuration and returns the solution of the first planner that
+		 * succeeds, after which all remaining planners are terminated.
+		 * 
+		 * Workers do not share any state, every planner requires its own
+		 * SimpleModel with a separately loaded scene as well as its own
+		 * sampler, nearest neighbor data structure, and verifier. Samplers
+		 * should be seeded differently, as the speedup results from the
+		 * variance in the runtime of the individual searches.
+		 */
+		class RL_PLAN_EXPORT ParallelPlanner : public Planner
+		{
+		public:
+			ParallelPlanner();
+			
+			virtual ~ParallelPlanner();
+			
+			virtual ::std::string getName() const;
+			
+			/**
+			 * Get solution path of first successful planner.
+			 * 
+			 * @pre solve()
+			 */
+			virtual VectorList getPath();
+			
+			/**
+			 * Get planner that found the solution.
+			 * 
+			 * @return Planner or nullptr if no solution was found
+			 */
+			Planner* getSolver() const;
+			
+			virtual void reset();
+			
+			virtual bool solve();
+			
+			/** Independent planners executed in parallel. */
+			::std::vector<Planner*> planners;
+			
+		protected:
+			
+		private:
+			Planner* solver;
+		};
+	}
+}
+
+#endif // RL_PLAN_PARALLELPLANNER_H
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "ParallelVerifier.h"
+#include "SimpleModel.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ParallelVerifier::ParallelVerifier() :
+			Verifier(),
+			models(),
+			pool()
+		{
+		}
+		
+		ParallelVerifier::~ParallelVerifier()
+		{
+		}
+		
+		bool
+		ParallelVerifier::isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d)
+		{
+			Edge edge;
+			edge.d = d;
+			edge.u = &u;
+			edge.v = &v;
+			
+			return this->isColliding(::std::vector<Edge>(1, edge)).front();
+		}
+		
+		::std::vector<bool>
+		ParallelVerifier::isColliding(const ::std::vector<Edge>& edges)
+		{
+			// interpolation steps of all edges, each in bisection order
+			
+			::std::vector< ::std::pair< ::std::size_t, ::rl::math::Real>> tasks;
+			
+			for (::std::size_t i = 0; i < edges.size(); ++i)
+			{
+				assert(edges[i].u->size() == this->model->getDofPosition());
+				assert(edges[i].v->size() == this->model->getDofPosition());
+				
+				::std::size_t steps = this->getSteps(edges[i].d);
+				
+				if (steps > 1)
+				{
+					::std::vector< ::std::pair< ::std::size_t, ::std::size_t>> queue(1, ::std::make_pair(1, steps - 1));
+					
+					for (::std::size_t j = 0; j < queue.size(); ++j)
+					{
+						::std::size_t midpoint = (queue[j].first + queue[j].second) / 2;
+						
+						tasks.push_back(::std::make_pair(i, static_cast< ::rl::math::Real>(midpoint) / static_cast< ::rl::math::Real>(steps)));
+						
+						if (queue[j].first < midpoint)
+						{
+							queue.push_back(::std::make_pair(queue[j].first, midpoint - 1));
+						}
+						
+						if (queue[j].second > midpoint)
+						{
+							queue.push_back(::std::make_pair(midpoint + 1, queue[j].second));
+						}
+					}
+				}
+			}
+			
+			::std::unique_ptr< ::std::atomic<bool>[]> colliding(new ::std::atomic<bool>[edges.size()]);
+			
+			for (::std::size_t i = 0; i < edges.size(); ++i)
+			{
+				colliding[i] = false;
+			}
+			
+			::std::atomic< ::std::size_t> next(0);
+			
+			::std::function<void(SimpleModel*)> work = [&](SimpleModel* model) {
+				::rl::math::Vector inter(model->getDofPosition());
+				
+				for (::std::size_t i = next++; i < tasks.size(); i = next++)
+				{
+					const Edge& edge = edges[tasks[i].first];
+					
+					if (colliding[tasks[i].first])
+					{
+						continue;
+					}
+					
+					model->interpolate(*edge.u, *edge.v, tasks[i].second, inter);
+					
+					if (model->isColliding(inter))
+					{
+						colliding[tasks[i].first] = true;
+					}
+				}
+			};
+			
+			if (this->models.size() > 1 && tasks.size() > 1)
+			{
+				this->pool.run(this->models, work);
+			}
+			else
+			{
+				work(this->models.empty() ? this->model : this->models[0]);
+			}
+			
+			::std::vector<bool> result(edges.size());
+			
+			for (::std::size_t i = 0; i < edges.size(); ++i)
+			{
+				result[i] = colliding[i];
+			}
+			
+			return result;
+		}
+	}
+}
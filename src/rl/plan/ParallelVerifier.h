@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_PARALLELVERIFIER_H
+#define RL_PLAN_PARALLELVERIFIER_H
+
+#include <vector>
+
+#include "Verifier.h"
+#include "WorkerPool.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Multi-threaded verification of edges.
+		 * 
+		 * Interpolated configurations of all edges are distributed over one
+		 * thread per model, with configurations of an edge tested in the same
+		 * bisection order as in RecursiveVerifier. Remaining configurations
+		 * of an edge are skipped as soon as any thread detects a collision.
+		 * Worker threads are started on first use and kept until destruction
+		 * or until the models change.
+		 */
+		class RL_PLAN_EXPORT ParallelVerifier : public Verifier
+		{
+		public:
+			ParallelVerifier();
+			
+			virtual ~ParallelVerifier();
+			
+			bool isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d);
+			
+			::std::vector<bool> isColliding(const ::std::vector<Edge>& edges);
+			
+			/**
+			 * Models used for collision queries, one thread per model.
+			 * 
+			 * Every model requires its own scene, as scenes do not support
+			 * concurrent queries. If empty, model is used in a single thread.
+			 */
+			::std::vector<SimpleModel*> models;
+			
+		protected:
+			
+		private:
+			WorkerPool pool;
+		};
+	}
+}
+
+#endif // RL_PLAN_PARALLELVERIFIER_H
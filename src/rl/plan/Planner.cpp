@@ -33,10 +33,12 @@ namespace rl
 	namespace plan
 	{
 		Planner::Planner() :
+			canceled(false),
 			duration(::std::chrono::steady_clock::duration::max()),
 			goal(nullptr),
 			model(nullptr),
 			start(nullptr),
+			statistics(nullptr),
 			viewer(nullptr),
 			time()
 		{
@@ -46,6 +48,12 @@ namespace rl
 		{
 		}
 		
+		bool
+		Planner::isTerminated() const
+		{
+			return this->canceled || (::std::chrono::steady_clock::now() - this->time) >= this->duration;
+		}
+		
 		bool
 		Planner::verify()
 		{
@@ -27,6 +27,7 @@
 #ifndef RL_PLAN_PLANNER_H
 #define RL_PLAN_PLANNER_H
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <rl/math/Vector.h>
@@ -42,6 +43,7 @@ namespace rl
 	namespace plan
 	{
 		class SimpleModel;
+		class Statistics;
 		class Viewer;
 		
 		class RL_PLAN_EXPORT Planner
@@ -75,6 +77,14 @@ namespace rl
 			 */
 			bool verify();
 			
+			/**
+			 * Terminate a running solve().
+			 * 
+			 * May be set from another thread. It is not reset by solve() and
+			 * needs to be set to false before solving again.
+			 */
+			::std::atomic<bool> canceled;
+			
 			/** Upper bound for search. */
 			::std::chrono::steady_clock::duration duration;
 			
@@ -86,9 +96,23 @@ namespace rl
 			/** Start configuration. */
 			::rl::math::Vector* start;
 			
+			/**
+			 * Record time and count of sampling, nearest neighbor queries,
+			 * edge verification, and graph updates if not null.
+			 * 
+			 * Collision queries are recorded by SimpleModel::statistics.
+			 */
+			Statistics* statistics;
+			
 			Viewer* viewer;
 			
 		protected:
+			/**
+			 * Check if search needs to stop, as it was canceled or its duration
+			 * is exceeded.
+			 */
+			bool isTerminated() const;
+			
 			::std::chrono::steady_clock::time_point time;
 			
 		private:
@@ -24,14 +24,21 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/incremental_components.hpp>
 
 #include "BridgeSampler.h"
+#include "Exception.h"
 #include "GaussianSampler.h"
+#include "HaltonSampler.h"
 #include "Prm.h"
 #include "Sampler.h"
 #include "SimpleModel.h"
+#include "Statistics.h"
 #include "UniformSampler.h"
 #include "Verifier.h"
 #include "Viewer.h"
@@ -54,7 +61,9 @@ namespace rl
 				::boost::get(&VertexBundle::parent, graph)
 			),
 			end(nullptr),
-			graph()
+			graph(),
+			stored(0),
+			storedFilename()
 		{
 		}
 		
@@ -65,7 +74,10 @@ namespace rl
 		Prm::Edge
 		Prm::addEdge(const Vertex& u, const Vertex& v, const ::rl::math::Real& weight)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			Edge e = ::boost::add_edge(u, v, this->graph).first;
+			this->graph[e].verified = true;
 			this->graph[e].weight = weight;
 			
 			this->ds.union_set(u, v);
@@ -81,6 +93,8 @@ namespace rl
 		Prm::Vertex
 		Prm::addVertex(const VectorPtr& q)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			Vertex v = ::boost::add_vertex(this->graph);
 			this->graph[v].index = ::boost::num_vertices(this->graph) - 1;
 			this->graph[v].q = q;
@@ -97,10 +111,16 @@ namespace rl
 		void
 		Prm::construct(const ::std::size_t& steps)
 		{
+			::rl::math::Matrix samples(this->model->getDofPosition(), steps);
+			
+			{
+				Statistics::Timer timer(this->statistics, Statistics::PHASE_SAMPLING, steps);
+				this->sampler->generateCollisionFree(samples);
+			}
+			
 			for (::std::size_t i = 0; i < steps; ++i)
 			{
-				VectorPtr q = ::std::make_shared< ::rl::math::Vector>(this->model->getDofPosition());
-				*q = this->sampler->generateCollisionFree();
+				VectorPtr q = ::std::make_shared< ::rl::math::Vector>(samples.col(i));
 				Vertex v = this->addVertex(q);
 				this->insert(v);
 			}
@@ -119,6 +139,10 @@ namespace rl
 				{
 					return "Gaussian PRM";
 				}
+				else if (typeid(*this->sampler) == typeid(HaltonSampler))
+				{
+					return "Halton PRM";
+				}
 			}
 			
 			return "PRM";
@@ -163,32 +187,192 @@ namespace rl
 		void
 		Prm::insert(const Vertex& v)
 		{
-			::std::vector<Neighbor> neighbors = this->graph[::boost::graph_bundle].nn->nearest(Metric::Value(this->graph[v].q.get(), v), this->k);
+			::std::vector<Neighbor> neighbors;
 			
-			for (::std::size_t i = 0; i < neighbors.size() && ::boost::degree(v, this->graph) < this->degree; ++i)
 			{
-				Vertex u = neighbors[i].second.second;
+				Statistics::Timer timer(this->statistics, Statistics::PHASE_NEAREST);
+				neighbors = this->graph[::boost::graph_bundle].nn->nearest(Metric::Value(this->graph[v].q.get(), v), this->k);
+			}
+			
+			::std::vector< ::std::pair<Vertex, ::rl::math::Real>> candidates;
+			
+			for (::std::size_t i = 0; i < neighbors.size(); ++i)
+			{
+				::rl::math::Real d = this->graph[::boost::graph_bundle].nn->isTransformedDistance() ? this->model->inverseOfTransformedDistance(neighbors[i].first) : neighbors[i].first;
+				
+				if (d < this->radius)
+				{
+					candidates.push_back(::std::make_pair(neighbors[i].second.second, d));
+				}
+			}
+			
+			// verify nearest remaining candidate of every other component as one batch,
+			// limited to remaining degree of v to test the same edges as one by one
+			
+			while (!candidates.empty() && ::boost::degree(v, this->graph) < this->degree)
+			{
+				::std::size_t capacity = this->degree - ::boost::degree(v, this->graph);
+				::std::vector< ::std::pair<Vertex, ::rl::math::Real>> batch;
+				::std::vector< ::std::pair<Vertex, ::rl::math::Real>> remaining;
+				::std::vector<Vertex> components;
 				
-				if (::boost::degree(u, this->graph) < this->degree)
+				for (::std::size_t i = 0; i < candidates.size(); ++i)
 				{
-					::rl::math::Real d = this->graph[::boost::graph_bundle].nn->isTransformedDistance() ? this->model->inverseOfTransformedDistance(neighbors[i].first) : neighbors[i].first;
+					Vertex u = candidates[i].first;
 					
-					if (d < this->radius)
+					if (::boost::degree(u, this->graph) < this->degree && !::boost::same_component(u, v, this->ds))
 					{
-						if (!::boost::same_component(u, v, this->ds))
+						Vertex component = this->ds.find_set(u);
+						
+						if (batch.size() < capacity && components.end() == ::std::find(components.begin(), components.end(), component))
+						{
+							components.push_back(component);
+							batch.push_back(candidates[i]);
+						}
+						else
 						{
-							if (!this->verifier->isColliding(*this->graph[u].q, *this->graph[v].q, d))
-							{
-								this->addEdge(u, v, d);
-							}
+							remaining.push_back(candidates[i]);
 						}
 					}
 				}
+				
+				::std::vector<Verifier::Edge> edges(batch.size());
+				
+				for (::std::size_t i = 0; i < batch.size(); ++i)
+				{
+					edges[i].d = batch[i].second;
+					edges[i].u = this->graph[batch[i].first].q.get();
+					edges[i].v = this->graph[v].q.get();
+				}
+				
+				::std::vector<bool> colliding;
+				
+				{
+					Statistics::Timer timer(this->statistics, Statistics::PHASE_VERIFICATION, edges.size());
+					colliding = this->verifier->isColliding(edges);
+				}
+				
+				for (::std::size_t i = 0; i < batch.size() && ::boost::degree(v, this->graph) < this->degree; ++i)
+				{
+					if (!colliding[i] && !::boost::same_component(batch[i].first, v, this->ds))
+					{
+						this->addEdge(batch[i].first, v, batch[i].second);
+					}
+				}
+				
+				candidates.swap(remaining);
 			}
 			
 			this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[v].q.get(), v));
 		}
 		
+		void
+		Prm::load(const ::std::string& filename)
+		{
+			::std::ifstream file(filename.c_str(), ::std::ios::binary);
+			
+			if (!file)
+			{
+				throw Exception("rl::plan::Prm::load() - Could not open file " + filename);
+			}
+			
+			file.seekg(0, ::std::ios::end);
+			::std::uint64_t size = file.tellg();
+			file.seekg(0, ::std::ios::beg);
+			
+			char magic[8];
+			::std::uint64_t real;
+			::std::uint64_t dof;
+			
+			file.read(magic, sizeof(magic));
+			file.read(reinterpret_cast<char*>(&real), sizeof(real));
+			file.read(reinterpret_cast<char*>(&dof), sizeof(dof));
+			
+			if (!file || 0 != ::std::memcmp(magic, "rlprm\0\0\1", sizeof(magic)))
+			{
+				throw Exception("rl::plan::Prm::load() - Invalid file " + filename);
+			}
+			
+			if (sizeof(::rl::math::Real) != real || this->model->getDofPosition() != dof)
+			{
+				throw Exception("rl::plan::Prm::load() - Incompatible roadmap in file " + filename);
+			}
+			
+			this->reset();
+			
+			::std::vector<Vertex> vertices;
+			
+			// counts are checked against remaining file size before allocating memory
+			
+			::std::uint64_t vertexSize = ::std::max< ::std::uint64_t>(1, dof) * sizeof(::rl::math::Real);
+			::std::uint64_t edgeSize = 2 * sizeof(::std::uint64_t) + sizeof(::rl::math::Real) + sizeof(char);
+			
+			for (::std::uint64_t numVertices; file.read(reinterpret_cast<char*>(&numVertices), sizeof(numVertices));)
+			{
+				if (numVertices > (size - static_cast< ::std::uint64_t>(file.tellg())) / vertexSize)
+				{
+					throw Exception("rl::plan::Prm::load() - Invalid number of vertices in file " + filename);
+				}
+				
+				vertices.reserve(vertices.size() + numVertices);
+				
+				for (::std::uint64_t i = 0; i < numVertices; ++i)
+				{
+					VectorPtr q = ::std::make_shared< ::rl::math::Vector>(dof);
+					
+					if (!file.read(reinterpret_cast<char*>(q->data()), dof * sizeof(::rl::math::Real)))
+					{
+						throw Exception("rl::plan::Prm::load() - Truncated file " + filename);
+					}
+					
+					Vertex v = this->addVertex(q);
+					this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[v].q.get(), v));
+					vertices.push_back(v);
+				}
+				
+				::std::uint64_t numEdges = 0;
+				
+				if (!file.read(reinterpret_cast<char*>(&numEdges), sizeof(numEdges)))
+				{
+					throw Exception("rl::plan::Prm::load() - Truncated file " + filename);
+				}
+				
+				if (numEdges > (size - static_cast< ::std::uint64_t>(file.tellg())) / edgeSize)
+				{
+					throw Exception("rl::plan::Prm::load() - Invalid number of edges in file " + filename);
+				}
+				
+				for (::std::uint64_t i = 0; i < numEdges; ++i)
+				{
+					::std::uint64_t u;
+					::std::uint64_t v;
+					::rl::math::Real weight;
+					char verified;
+					
+					file.read(reinterpret_cast<char*>(&u), sizeof(u));
+					file.read(reinterpret_cast<char*>(&v), sizeof(v));
+					file.read(reinterpret_cast<char*>(&weight), sizeof(weight));
+					file.read(&verified, sizeof(verified));
+					
+					if (!file || u >= vertices.size() || v >= vertices.size())
+					{
+						throw Exception("rl::plan::Prm::load() - Invalid edge in file " + filename);
+					}
+					
+					Edge e = this->addEdge(vertices[u], vertices[v], weight);
+					this->graph[e].verified = 0 != verified;
+				}
+			}
+			
+			if (!file.eof() || 0 != file.gcount())
+			{
+				throw Exception("rl::plan::Prm::load() - Could not read file " + filename);
+			}
+			
+			this->stored = vertices.size();
+			this->storedFilename = filename;
+		}
+		
 		void
 		Prm::reset()
 		{
@@ -196,35 +380,101 @@ namespace rl
 			this->graph[::boost::graph_bundle].nn->clear();
 			this->begin = nullptr;
 			this->end = nullptr;
+			this->stored = 0;
+			this->storedFilename.clear();
 		}
 		
 		void
-		Prm::setNearestNeighbors(NearestNeighbors* nearestNeighbors)
+		Prm::save(const ::std::string& filename, const bool& append)
 		{
-			this->graph[::boost::graph_bundle].nn = nearestNeighbors;
-		}
-		
-		bool
-		Prm::solve()
-		{
-			this->time = ::std::chrono::steady_clock::now();
+			bool header = !append;
 			
-			this->begin = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->start));
-			this->insert(this->begin);
+			if (append)
+			{
+				// write header and complete roadmap if file is missing or empty
+				::std::ifstream existing(filename.c_str(), ::std::ios::binary | ::std::ios::ate);
+				header = !existing || 0 == existing.tellg();
+				
+				if (!header && filename != this->storedFilename)
+				{
+					throw Exception("rl::plan::Prm::save() - Roadmap was not stored in file " + filename);
+				}
+			}
 			
-			this->end = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->goal));
-			this->insert(this->end);
+			::std::ofstream file(filename.c_str(), header ? ::std::ios::binary | ::std::ios::trunc : ::std::ios::binary | ::std::ios::app);
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration && !::boost::same_component(this->begin, this->end, this->ds))
+			if (!file)
 			{
-				this->construct(1);
+				throw Exception("rl::plan::Prm::save() - Could not open file " + filename);
 			}
 			
-			if (!::boost::same_component(this->begin, this->end, this->ds))
+			::std::size_t first = header ? 0 : this->stored;
+			
+			if (header)
 			{
-				return false;
+				::std::uint64_t real = sizeof(::rl::math::Real);
+				::std::uint64_t dof = this->model->getDofPosition();
+				
+				file.write("rlprm\0\0\1", 8);
+				file.write(reinterpret_cast<const char*>(&real), sizeof(real));
+				file.write(reinterpret_cast<const char*>(&dof), sizeof(dof));
+			}
+			
+			::std::vector<Vertex> vertices(::boost::num_vertices(this->graph) - first);
+			
+			for (VertexIteratorPair i = ::boost::vertices(this->graph); i.first != i.second; ++i.first)
+			{
+				if (this->graph[*i.first].index >= first)
+				{
+					vertices[this->graph[*i.first].index - first] = *i.first;
+				}
+			}
+			
+			::std::uint64_t numVertices = vertices.size();
+			file.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+			
+			for (::std::size_t i = 0; i < vertices.size(); ++i)
+			{
+				file.write(reinterpret_cast<const char*>(this->graph[vertices[i]].q->data()), this->graph[vertices[i]].q->size() * sizeof(::rl::math::Real));
 			}
 			
+			::std::vector<Edge> edges;
+			
+			for (EdgeIteratorPair i = ::boost::edges(this->graph); i.first != i.second; ++i.first)
+			{
+				if (this->graph[::boost::source(*i.first, this->graph)].index >= first || this->graph[::boost::target(*i.first, this->graph)].index >= first)
+				{
+					edges.push_back(*i.first);
+				}
+			}
+			
+			::std::uint64_t numEdges = edges.size();
+			file.write(reinterpret_cast<const char*>(&numEdges), sizeof(numEdges));
+			
+			for (::std::size_t i = 0; i < edges.size(); ++i)
+			{
+				::std::uint64_t u = this->graph[::boost::source(edges[i], this->graph)].index;
+				::std::uint64_t v = this->graph[::boost::target(edges[i], this->graph)].index;
+				char verified = this->graph[edges[i]].verified ? 1 : 0;
+				
+				file.write(reinterpret_cast<const char*>(&u), sizeof(u));
+				file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+				file.write(reinterpret_cast<const char*>(&this->graph[edges[i]].weight), sizeof(::rl::math::Real));
+				file.write(&verified, sizeof(verified));
+			}
+			
+			if (!file)
+			{
+				throw Exception("rl::plan::Prm::save() - Could not write file " + filename);
+			}
+			
+			this->stored = ::boost::num_vertices(this->graph);
+			this->storedFilename = filename;
+		}
+		
+		void
+		Prm::search()
+		{
 			if (this->astar)
 			{
 				::boost::astar_search(
@@ -260,6 +510,36 @@ namespace rl
 					::boost::default_dijkstra_visitor()
 				);
 			}
+		}
+		
+		void
+		Prm::setNearestNeighbors(NearestNeighbors* nearestNeighbors)
+		{
+			this->graph[::boost::graph_bundle].nn = nearestNeighbors;
+		}
+		
+		bool
+		Prm::solve()
+		{
+			this->time = ::std::chrono::steady_clock::now();
+			
+			this->begin = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->start));
+			this->insert(this->begin);
+			
+			this->end = this->addVertex(::std::make_shared< ::rl::math::Vector>(*this->goal));
+			this->insert(this->end);
+			
+			while (!this->isTerminated() && !::boost::same_component(this->begin, this->end, this->ds))
+			{
+				this->construct(::std::max< ::std::size_t>(1, this->sampler->models.size()));
+			}
+			
+			if (!::boost::same_component(this->begin, this->end, this->ds))
+			{
+				return false;
+			}
+			
+			this->search();
 			
 			return true;
 		}
@@ -27,6 +27,7 @@
 #ifndef RL_PLAN_PRM_H
 #define RL_PLAN_PRM_H
 
+#include <string>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/astar_search.hpp>
 #include <boost/pending/disjoint_sets.hpp>
@@ -80,8 +81,35 @@ namespace rl
 			
 			VectorList getPath();
 			
+			/**
+			 * Load roadmap from binary file and rebuild nearest neighbors.
+			 * 
+			 * Replaces the current roadmap. The nearest neighbor data structure
+			 * must be set and empty or cleared by reset().
+			 * 
+			 * @see save()
+			 */
+			void load(const ::std::string& filename);
+			
 			void reset();
 			
+			/**
+			 * Save roadmap to binary file.
+			 * 
+			 * The file consists of a header followed by blocks of vertices
+			 * and edges, using native byte order and floating point format.
+			 * 
+			 * @param[in] append Append vertices and edges added since last
+			 * call to load() or save() as a new block to an existing file,
+			 * edges removed in the meantime are not reflected. A missing or
+			 * empty file receives a header and the complete roadmap.
+			 * 
+			 * @throws Exception If appending to a non-empty file this roadmap
+			 * was not loaded from or saved to, as its vertex indices would
+			 * refer to vertices of other blocks.
+			 */
+			void save(const ::std::string& filename, const bool& append = false);
+			
 			void setNearestNeighbors(NearestNeighbors* nearestNeighbors);
 			
 			bool solve();
@@ -104,6 +132,9 @@ namespace rl
 		protected:
 			struct EdgeBundle
 			{
+				/** Edge has been checked for collisions. */
+				bool verified;
+				
 				::rl::math::Real weight;
 			};
 			
@@ -186,7 +217,15 @@ namespace rl
 			
 			Vertex addVertex(const VectorPtr& q);
 			
-			void insert(const Vertex& vertex);
+			virtual void insert(const Vertex& vertex);
+			
+			/**
+			 * Find shortest path from begin to all vertices.
+			 * 
+			 * Uses A* or Dijkstra's algorithm depending on astar and stores
+			 * the result in the predecessor of every vertex.
+			 */
+			void search();
 			
 			Vertex begin;
 			
@@ -196,6 +235,12 @@ namespace rl
 			
 			Graph graph;
 			
+			/** Number of vertices stored in file by load() or save(). */
+			::std::size_t stored;
+			
+			/** File used by last call to load() or save(). */
+			::std::string storedFilename;
+			
 		private:
 			
 		};
@@ -27,6 +27,7 @@
 #include "Rrt.h"
 #include "Sampler.h"
 #include "SimpleModel.h"
+#include "Statistics.h"
 #include "Viewer.h"
 
 namespace rl
@@ -51,6 +52,8 @@ namespace rl
 		Rrt::Edge
 		Rrt::addEdge(const Vertex& u, const Vertex& v, Tree& tree)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			Edge e = ::boost::add_edge(u, v, tree).first;
 			
 			if (nullptr != this->viewer)
@@ -64,6 +67,8 @@ namespace rl
 		Rrt::Vertex
 		Rrt::addVertex(Tree& tree, const VectorPtr& q)
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_GRAPH);
+			
 			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
 			bundle->index = ::boost::num_vertices(tree) - 1;
 			bundle->q = q;
@@ -97,6 +102,7 @@ namespace rl
 		::rl::math::Vector
 		Rrt::choose()
 		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_SAMPLING);
 			return this->sampler->generate();
 		}
 		
@@ -248,7 +254,12 @@ namespace rl
 		Rrt::Neighbor
 		Rrt::nearest(const Tree& tree, const ::rl::math::Vector& chosen)
 		{
-			::std::vector<NearestNeighbors::Neighbor> neighbors = tree[::boost::graph_bundle].nn->nearest(Metric::Value(&chosen, Vertex()), 1);
+			::std::vector<NearestNeighbors::Neighbor> neighbors;
+			
+			{
+				Statistics::Timer timer(this->statistics, Statistics::PHASE_NEAREST);
+				neighbors = tree[::boost::graph_bundle].nn->nearest(Metric::Value(&chosen, Vertex()), 1);
+			}
 			return Neighbor(
 				tree[::boost::graph_bundle].nn->isTransformedDistance() ? this->model->inverseOfTransformedDistance(neighbors.front().first) : neighbors.front().first,
 				neighbors.front().second.second
@@ -280,7 +291,7 @@ namespace rl
 			
 			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared< ::rl::math::Vector>(*this->start));
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration)
+			while (!this->isTerminated())
 			{
 				::rl::math::Vector chosen = this->choose();
 				Neighbor nearest = this->nearest(this->tree[0], chosen);
@@ -53,7 +53,7 @@ namespace rl
 			
 			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared< ::rl::math::Vector>(*this->start));
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration)
+			while (!this->isTerminated())
 			{
 				::rl::math::Vector chosen = this->choose();
 				Neighbor nearest = this->nearest(this->tree[0], chosen);
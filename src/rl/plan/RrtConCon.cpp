@@ -57,7 +57,7 @@ namespace rl
 			Tree* a = &this->tree[0];
 			Tree* b = &this->tree[1];
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->duration)
+			while (!this->isTerminated())
 			{
 				for (::std::size_t j = 0; j < 2; ++j)
 				{
@@ -24,6 +24,11 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <rl/sg/Scene.h>
+
 #include "Sampler.h"
 #include "SimpleModel.h"
 
@@ -32,7 +37,13 @@ namespace rl
 	namespace plan
 	{
 		Sampler::Sampler() :
-			model(nullptr)
+			model(nullptr),
+			models(),
+			surplus(),
+			pool(),
+			surplusModel(nullptr),
+			surplusRevision(0),
+			surplusScene(nullptr)
 		{
 		}
 		
@@ -43,6 +54,18 @@ namespace rl
 		::rl::math::Vector
 		Sampler::generateCollisionFree()
 		{
+			if (this->isSurplusOutdated())
+			{
+				this->surplus.clear();
+			}
+			
+			if (!this->surplus.empty())
+			{
+				::rl::math::Vector q = this->surplus.front();
+				this->surplus.pop_front();
+				return q;
+			}
+			
 			::rl::math::Vector q(this->model->getDofPosition());
 			
 			do
@@ -53,5 +76,82 @@ namespace rl
 			
 			return q;
 		}
+		
+		void
+		Sampler::generateCollisionFree(::rl::math::Matrix& q)
+		{
+			assert(q.rows() == this->model->getDofPosition());
+			
+			if (this->isSurplusOutdated())
+			{
+				this->surplus.clear();
+			}
+			
+			::std::ptrdiff_t count = 0;
+			
+			for (; count < q.cols() && !this->surplus.empty(); ++count)
+			{
+				q.col(count) = this->surplus.front();
+				this->surplus.pop_front();
+			}
+			
+			if (this->models.size() < 2)
+			{
+				for (; count < q.cols(); ++count)
+				{
+					q.col(count) = this->generateCollisionFree();
+				}
+				
+				return;
+			}
+			
+			::std::vector< ::rl::math::Vector> candidates;
+			::std::vector<char> colliding;
+			
+			while (count < q.cols())
+			{
+				candidates.resize(::std::max< ::std::size_t>(q.cols() - count, this->models.size()));
+				
+				for (::std::size_t i = 0; i < candidates.size(); ++i)
+				{
+					candidates[i] = this->generate();
+				}
+				
+				colliding.assign(candidates.size(), false);
+				
+				::std::atomic< ::std::size_t> next(0);
+				
+				::std::function<void(SimpleModel*)> work = [&](SimpleModel* model) {
+					for (::std::size_t i = next++; i < candidates.size(); i = next++)
+					{
+						colliding[i] = model->isColliding(candidates[i]);
+					}
+				};
+				
+				this->pool.run(this->models, work);
+				
+				for (::std::size_t i = 0; i < candidates.size(); ++i)
+				{
+					if (!colliding[i] && count < q.cols())
+					{
+						q.col(count++) = candidates[i];
+					}
+					else if (!colliding[i])
+					{
+						this->surplus.push_back(candidates[i]);
+					}
+				}
+			}
+			
+			this->surplusModel = this->model;
+			this->surplusRevision = this->model->scene->getRevision();
+			this->surplusScene = this->model->scene;
+		}
+		
+		bool
+		Sampler::isSurplusOutdated() const
+		{
+			return this->model != this->surplusModel || this->model->scene != this->surplusScene || this->model->scene->getRevision() != this->surplusRevision;
+		}
 	}
 }
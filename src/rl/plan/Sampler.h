@@ -27,11 +27,21 @@
 #ifndef RL_PLAN_SAMPLER_H
 #define RL_PLAN_SAMPLER_H
 
+#include <deque>
+#include <vector>
+#include <rl/math/Matrix.h>
 #include <rl/math/Vector.h>
 #include <rl/plan/export.h>
 
+#include "WorkerPool.h"
+
 namespace rl
 {
+	namespace sg
+	{
+		class Scene;
+	}
+	
 	namespace plan
 	{
 		class SimpleModel;
@@ -47,12 +57,43 @@ namespace rl
 			
 			virtual ::rl::math::Vector generateCollisionFree();
 			
+			/**
+			 * Fill columns of a matrix with collision-free configurations.
+			 * 
+			 * With more than one model, batches of generated configurations are
+			 * rejected in parallel with one thread per model. Collision-free
+			 * configurations exceeding the matrix are kept and returned first by
+			 * the next calls, so that no part of a deterministic sequence is
+			 * skipped, unless model, scene, or the bodies of the scene changed
+			 * in the meantime. Worker threads are kept between calls. Otherwise,
+			 * every column is filled by generateCollisionFree().
+			 */
+			virtual void generateCollisionFree(::rl::math::Matrix& q);
+			
 			SimpleModel* model;
 			
+			/**
+			 * Models used for parallel collision queries, one thread per model.
+			 * 
+			 * Every model requires its own scene, as scenes do not support
+			 * concurrent queries.
+			 */
+			::std::vector<SimpleModel*> models;
+			
 		protected:
+			/** Collision-free configurations left over from a parallel batch. */
+			::std::deque< ::rl::math::Vector> surplus;
 			
 		private:
+			bool isSurplusOutdated() const;
+			
+			WorkerPool pool;
+			
+			SimpleModel* surplusModel;
+			
+			::std::size_t surplusRevision;
 			
+			::rl::sg::Scene* surplusScene;
 		};
 	}
 }
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "ShortcutOptimizer.h"
+#include "SimpleModel.h"
+#include "Verifier.h"
+#include "Viewer.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ShortcutOptimizer::ShortcutOptimizer() :
+			Optimizer(),
+			duration(::std::chrono::steady_clock::duration::max()),
+			iterations(100),
+			shortcuts(64),
+			randEngine(::std::random_device()())
+		{
+		}
+		
+		ShortcutOptimizer::~ShortcutOptimizer()
+		{
+		}
+		
+		void
+		ShortcutOptimizer::process(VectorList& path)
+		{
+			::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+			
+			::std::vector< ::rl::math::Vector> vertices(path.begin(), path.end());
+			
+			::std::vector< ::std::pair< ::std::size_t, ::std::size_t>> candidates;
+			::std::vector<Verifier::Edge> edges;
+			::std::vector< ::rl::math::Real> lengths;
+			
+			for (::std::size_t i = 0; i < this->iterations && vertices.size() > 2; ++i)
+			{
+				if (::std::chrono::steady_clock::now() - start > this->duration)
+				{
+					break;
+				}
+				
+				// cumulative path length at vertices
+				
+				lengths.assign(vertices.size(), 0);
+				
+				for (::std::size_t j = 1; j < vertices.size(); ++j)
+				{
+					lengths[j] = lengths[j - 1] + this->model->distance(vertices[j - 1], vertices[j]);
+				}
+				
+				// propose shortcuts between random vertices
+				
+				::std::uniform_int_distribution< ::std::size_t> distribution(0, vertices.size() - 1);
+				
+				candidates.clear();
+				
+				for (::std::size_t j = 0; j < this->shortcuts; ++j)
+				{
+					::std::size_t first = distribution(this->randEngine);
+					::std::size_t second = distribution(this->randEngine);
+					
+					if (first > second)
+					{
+						::std::swap(first, second);
+					}
+					
+					if (second - first > 1)
+					{
+						candidates.push_back(::std::make_pair(first, second));
+					}
+				}
+				
+				::std::sort(candidates.begin(), candidates.end());
+				candidates.erase(::std::unique(candidates.begin(), candidates.end()), candidates.end());
+				
+				edges.resize(candidates.size());
+				
+				for (::std::size_t j = 0; j < candidates.size(); ++j)
+				{
+					edges[j].d = this->model->distance(vertices[candidates[j].first], vertices[candidates[j].second]);
+					edges[j].u = &vertices[candidates[j].first];
+					edges[j].v = &vertices[candidates[j].second];
+				}
+				
+				::std::vector<bool> colliding = this->verifier->isColliding(edges);
+				
+				// apply non-overlapping shortcuts with highest gain
+				
+				::std::vector< ::std::pair< ::rl::math::Real, ::std::size_t>> gains;
+				
+				for (::std::size_t j = 0; j < candidates.size(); ++j)
+				{
+					::rl::math::Real gain = lengths[candidates[j].second] - lengths[candidates[j].first] - edges[j].d;
+					
+					if (!colliding[j] && gain > 0)
+					{
+						gains.push_back(::std::make_pair(gain, j));
+					}
+				}
+				
+				if (gains.empty())
+				{
+					continue;
+				}
+				
+				::std::sort(gains.begin(), gains.end(), ::std::greater< ::std::pair< ::rl::math::Real, ::std::size_t>>());
+				
+				::std::vector<bool> covered(vertices.size() - 1, false);
+				::std::vector<bool> removed(vertices.size(), false);
+				
+				for (::std::size_t j = 0; j < gains.size(); ++j)
+				{
+					const ::std::pair< ::std::size_t, ::std::size_t>& candidate = candidates[gains[j].second];
+					
+					if (::std::find(covered.begin() + candidate.first, covered.begin() + candidate.second, true) != covered.begin() + candidate.second)
+					{
+						continue;
+					}
+					
+					::std::fill(covered.begin() + candidate.first, covered.begin() + candidate.second, true);
+					::std::fill(removed.begin() + candidate.first + 1, removed.begin() + candidate.second, true);
+				}
+				
+				::std::size_t k = 0;
+				
+				for (::std::size_t j = 0; j < vertices.size(); ++j)
+				{
+					if (!removed[j])
+					{
+						if (k != j)
+						{
+							vertices[k].swap(vertices[j]);
+						}
+						
+						++k;
+					}
+				}
+				
+				vertices.resize(k);
+				
+				if (nullptr != this->viewer)
+				{
+					this->viewer->drawConfigurationPath(VectorList(vertices.begin(), vertices.end()));
+				}
+			}
+			
+			path.assign(vertices.begin(), vertices.end());
+		}
+		
+		void
+		ShortcutOptimizer::seed(const ::std::mt19937::result_type& value)
+		{
+			this->randEngine.seed(value);
+		}
+	}
+}
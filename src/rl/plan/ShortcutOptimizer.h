@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_SHORTCUTOPTIMIZER_H
+#define RL_PLAN_SHORTCUTOPTIMIZER_H
+
+#include <chrono>
+#include <random>
+
+#include "Optimizer.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Random shortcut path optimization.
+		 * 
+		 * In each round, a batch of shortcuts between random vertices of the
+		 * path is verified at once, which is done in parallel when using a
+		 * ParallelVerifier with one model per thread. Of the collision-free
+		 * shortcuts, non-overlapping ones are applied in order of decreasing
+		 * reduction of path length. Optimization stops when the number of
+		 * rounds or the duration is exceeded.
+		 */
+		class RL_PLAN_EXPORT ShortcutOptimizer : public Optimizer
+		{
+		public:
+			ShortcutOptimizer();
+			
+			virtual ~ShortcutOptimizer();
+			
+			void process(VectorList& path);
+			
+			virtual void seed(const ::std::mt19937::result_type& value);
+			
+			/** Maximum duration of optimization. */
+			::std::chrono::steady_clock::duration duration;
+			
+			/** Maximum number of rounds. */
+			::std::size_t iterations;
+			
+			/** Number of shortcuts verified per round. */
+			::std::size_t shortcuts;
+			
+		protected:
+			::std::mt19937 randEngine;
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_PLAN_SHORTCUTOPTIMIZER_H
@@ -24,10 +24,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cmath>
 #include <rl/sg/Body.h>
 #include <rl/sg/SimpleScene.h>
 
 #include "SimpleModel.h"
+#include "Statistics.h"
 
 namespace rl
 {
@@ -35,9 +37,25 @@ namespace rl
 	{
 		SimpleModel::SimpleModel() :
 			Model(),
+			statistics(nullptr),
 			body(0),
 			freeQueries(0),
-			totalQueries(0)
+			totalQueries(0),
+			cache(),
+			cacheFrames(),
+			cacheHits(0),
+			cacheKey(),
+			cacheKeys(),
+			cacheMisses(0),
+			cacheResolution(static_cast< ::rl::math::Real>(1.0e-6)),
+			cacheSize(0),
+			lastPairFirst(true),
+			pair(0),
+			pairs(),
+			pairsModel(nullptr),
+			pairsRevision(0),
+			pairsScene(nullptr),
+			simpleScene(nullptr)
 		{
 		}
 		
@@ -45,6 +63,37 @@ namespace rl
 		{
 		}
 		
+		void
+		SimpleModel::clearCache()
+		{
+			this->cache.clear();
+			this->cacheKeys.clear();
+		}
+		
+		::std::size_t
+		SimpleModel::getCacheHits() const
+		{
+			return this->cacheHits;
+		}
+		
+		::std::size_t
+		SimpleModel::getCacheMisses() const
+		{
+			return this->cacheMisses;
+		}
+		
+		const ::rl::math::Real&
+		SimpleModel::getCacheResolution() const
+		{
+			return this->cacheResolution;
+		}
+		
+		::std::size_t
+		SimpleModel::getCacheSize() const
+		{
+			return this->cacheSize;
+		}
+		
 		::std::size_t
 		SimpleModel::getCollidingBody() const
 		{
@@ -57,47 +106,113 @@ namespace rl
 			return this->freeQueries;
 		}
 		
+		bool
+		SimpleModel::getLastPairFirst() const
+		{
+			return this->lastPairFirst;
+		}
+		
 		::std::size_t
 		SimpleModel::getTotalQueries() const
 		{
 			return this->totalQueries;
 		}
 		
+		void
+		SimpleModel::invalidatePairs()
+		{
+			this->pairsModel = nullptr;
+		}
+		
 		bool
 		SimpleModel::isColliding()
 		{
+			if (this->isPairsOutdated())
+			{
+				this->updatePairs();
+			}
+			
+			return this->isCollidingPairs();
+		}
+		
+		bool
+		SimpleModel::isColliding(const ::rl::math::Vector& q)
+		{
+			this->setPosition(q);
+			this->updateFrames();
+			
+			if (0 == this->cacheSize)
+			{
+				return this->isColliding();
+			}
+			
+			if (this->isPairsOutdated())
+			{
+				this->updatePairs();
+			}
+			
+			this->updateCacheFrames();
+			
+			this->cacheKey.resize(q.size());
+			
+			for (::std::ptrdiff_t i = 0; i < q.size(); ++i)
+			{
+				this->cacheKey[i] = ::std::llround(q(i) / this->cacheResolution);
+			}
+			
+			Cache::iterator found = this->cache.find(this->cacheKey);
+			
+			if (this->cache.end() != found)
+			{
+				++this->cacheHits;
+				this->body = found->second.second;
+				return found->second.first;
+			}
+			
+			++this->cacheMisses;
+			
+			bool colliding = this->isCollidingPairs();
+			
+			if (this->cache.size() >= this->cacheSize)
+			{
+				this->cache.erase(this->cache.find(*this->cacheKeys.front()));
+				this->cacheKeys.pop_front();
+			}
+			
+			::std::pair<Cache::iterator, bool> inserted = this->cache.emplace(this->cacheKey, ::std::make_pair(colliding, this->body));
+			this->cacheKeys.push_back(&inserted.first->first);
+			
+			return colliding;
+		}
+		
+		bool
+		SimpleModel::isCollidingPairs()
+		{
+			Statistics::Timer timer(this->statistics, Statistics::PHASE_COLLISION);
+			
 			++this->totalQueries;
 			
-			for (::std::size_t i = 0; i < this->model->getNumBodies(); ++i)
+			if (this->lastPairFirst && this->pair < this->pairs.size())
 			{
-				if (this->isColliding(i))
+				if (this->simpleScene->areColliding(this->pairs[this->pair].first, this->pairs[this->pair].second))
 				{
-					for (::rl::sg::Scene::Iterator j = this->scene->begin(); j != this->scene->end(); ++j)
-					{
-						if (this->model != *j)
-						{
-							for (::rl::sg::Model::Iterator k = (*j)->begin(); k != (*j)->end(); ++k)
-							{
-								if (dynamic_cast< ::rl::sg::SimpleScene*>(this->scene)->areColliding(this->model->getBody(i), *k))
-								{
-									this->body = i;
-									return true;
-								}
-							}
-						}
-					}
+					this->body = this->pairs[this->pair].body;
+					return true;
+				}
+			}
+			
+			for (::std::size_t i = 0; i < this->pairs.size(); ++i)
+			{
+				if (this->lastPairFirst && this->pair == i)
+				{
+					continue;
 				}
 				
-				for (::std::size_t j = 0; j < i; ++j)
+				if (this->simpleScene->areColliding(this->pairs[i].first, this->pairs[i].second))
 				{
-					if (this->areColliding(i, j))
-					{
-						if (dynamic_cast< ::rl::sg::SimpleScene*>(this->scene)->areColliding(this->model->getBody(i), this->model->getBody(j)))
-						{
-							this->body = i;
-							return true;
-						}
-					}
+					this->body = this->pairs[i].body;
+					this->pair = i;
+					return true;
 				}
 			}
 			
@@ -107,19 +222,132 @@ namespace rl
 		}
 		
 		bool
-		SimpleModel::isColliding(const ::rl::math::Vector& q)
+		SimpleModel::isPairsOutdated() const
 		{
-			this->setPosition(q);
-			this->updateFrames();
-			return this->isColliding();
+			return this->model != this->pairsModel || this->scene != this->pairsScene || this->scene->getRevision() != this->pairsRevision;
 		}
 		
 		void
 		SimpleModel::reset()
 		{
 			this->body = 0;
+			this->cacheFrames.clear();
+			this->cacheHits = 0;
+			this->cacheMisses = 0;
+			this->clearCache();
 			this->freeQueries = 0;
+			this->pair = 0;
+			this->pairs.clear();
+			this->pairsModel = nullptr;
+			this->pairsRevision = 0;
+			this->pairsScene = nullptr;
+			this->simpleScene = nullptr;
 			this->totalQueries = 0;
 		}
+		
+		void
+		SimpleModel::setCacheResolution(const ::rl::math::Real& cacheResolution)
+		{
+			this->cacheResolution = cacheResolution;
+			this->clearCache();
+		}
+		
+		void
+		SimpleModel::setCacheSize(const ::std::size_t& cacheSize)
+		{
+			this->cacheSize = cacheSize;
+			
+			while (this->cache.size() > this->cacheSize)
+			{
+				this->cache.erase(this->cache.find(*this->cacheKeys.front()));
+				this->cacheKeys.pop_front();
+			}
+		}
+		
+		void
+		SimpleModel::setLastPairFirst(const bool& lastPairFirst)
+		{
+			this->lastPairFirst = lastPairFirst;
+		}
+		
+		void
+		SimpleModel::updateCacheFrames()
+		{
+			bool moved = false;
+			::std::size_t n = 0;
+			::rl::math::Transform frame;
+			
+			for (::rl::sg::Scene::Iterator i = this->scene->begin(); i != this->scene->end(); ++i)
+			{
+				if (this->model != *i)
+				{
+					for (::rl::sg::Model::Iterator j = (*i)->begin(); j != (*i)->end(); ++j, ++n)
+					{
+						(*j)->getFrame(frame);
+						
+						if (n == this->cacheFrames.size())
+						{
+							this->cacheFrames.push_back(frame);
+							moved = true;
+						}
+						else if (frame.matrix() != this->cacheFrames[n].matrix())
+						{
+							this->cacheFrames[n] = frame;
+							moved = true;
+						}
+					}
+				}
+			}
+			
+			if (n < this->cacheFrames.size())
+			{
+				this->cacheFrames.resize(n);
+				moved = true;
+			}
+			
+			if (moved)
+			{
+				this->clearCache();
+			}
+		}
+		
+		void
+		SimpleModel::updatePairs()
+		{
+			this->clearCache();
+			this->pair = 0;
+			this->pairs.clear();
+			this->pairsModel = this->model;
+			this->pairsRevision = this->scene->getRevision();
+			this->pairsScene = this->scene;
+			this->simpleScene = dynamic_cast< ::rl::sg::SimpleScene*>(this->scene);
+			
+			for (::std::size_t i = 0; i < this->model->getNumBodies(); ++i)
+			{
+				if (this->isColliding(i))
+				{
+					for (::rl::sg::Scene::Iterator j = this->scene->begin(); j != this->scene->end(); ++j)
+					{
+						if (this->model != *j)
+						{
+							for (::rl::sg::Model::Iterator k = (*j)->begin(); k != (*j)->end(); ++k)
+							{
+								Pair pair = {i, this->model->getBody(i), *k};
+								this->pairs.push_back(pair);
+							}
+						}
+					}
+				}
+				
+				for (::std::size_t j = 0; j < i; ++j)
+				{
+					if (this->areColliding(i, j))
+					{
+						Pair pair = {i, this->model->getBody(i), this->model->getBody(j)};
+						this->pairs.push_back(pair);
+					}
+				}
+			}
+		}
 	}
 }
@@ -27,12 +27,39 @@
 #ifndef RL_PLAN_SIMPLEMODEL_H
 #define RL_PLAN_SIMPLEMODEL_H
 
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/functional/hash.hpp>
+
 #include "Model.h"
 
 namespace rl
 {
+	namespace sg
+	{
+		class Body;
+		class SimpleScene;
+	}
+	
 	namespace plan
 	{
+		class Statistics;
+		
+		/**
+		 * Collision queries with a simple scene.
+		 * 
+		 * Body pairs to test are collected once and collected again after
+		 * structural changes of the scene, i.e., a new revision of the scene,
+		 * after invalidatePairs(), or after reset(). By default, the pair that
+		 * collided in the last query is tested first.
+		 * 
+		 * Optionally, results of configuration queries are cached with
+		 * configurations quantized to a given resolution. The cache is cleared
+		 * together with the body pairs and after obstacles were moved.
+		 */
 		class RL_PLAN_EXPORT SimpleModel : public Model
 		{
 		public:
@@ -40,20 +67,78 @@ namespace rl
 			
 			virtual ~SimpleModel();
 			
+			::std::size_t getCacheHits() const;
+			
+			::std::size_t getCacheMisses() const;
+			
+			const ::rl::math::Real& getCacheResolution() const;
+			
+			::std::size_t getCacheSize() const;
+			
 			::std::size_t getCollidingBody() const;
 			
 			::std::size_t getFreeQueries() const;
 			
+			bool getLastPairFirst() const;
+			
 			::std::size_t getTotalQueries() const;
 			
+			/**
+			 * Collect body pairs again before the next query.
+			 * 
+			 * Required after changing which bodies are tested for collisions,
+			 * e.g., via ::rl::kin::Kinematics::setColliding(). Changes of the
+			 * scene's bodies are detected automatically.
+			 */
+			void invalidatePairs();
+			
 			using Model::isColliding;
 			
 			virtual bool isColliding();
 			
+			/**
+			 * Test configuration for collision.
+			 * 
+			 * If the result of a configuration within the cache resolution is
+			 * cached, it is returned without a collision query. The frames of
+			 * the model are updated in either case.
+			 */
 			virtual bool isColliding(const ::rl::math::Vector& q);
 			
 			virtual void reset();
 			
+			/**
+			 * Set resolution of quantized configurations in the cache.
+			 * 
+			 * Configurations are considered equal if all of their components
+			 * round to the same multiple of the resolution.
+			 */
+			void setCacheResolution(const ::rl::math::Real& cacheResolution);
+			
+			/**
+			 * Set maximum number of cached configuration queries.
+			 * 
+			 * Entries are evicted in insertion order. A size of zero disables
+			 * the cache, which is the default.
+			 * 
+			 * The frames of all obstacle bodies are compared on each query and
+			 * the cache is cleared if any of them changed.
+			 */
+			void setCacheSize(const ::std::size_t& cacheSize);
+			
+			/**
+			 * Test pair of last collision first.
+			 * 
+			 * Successive queries, e.g., during extension of a tree towards
+			 * an obstacle, often collide with the same pair of bodies. If
+			 * enabled, the reported colliding body is not necessarily the
+			 * one with the lowest index.
+			 */
+			void setLastPairFirst(const bool& lastPairFirst);
+			
+			/** Record collision queries if not null. */
+			Statistics* statistics;
+			
 		protected:
 			::std::size_t body;
 			
@@ -62,7 +147,60 @@ namespace rl
 			::std::size_t totalQueries;
 			
 		private:
+			typedef ::std::vector< ::std::int64_t> CacheKey;
+			
+			typedef ::std::unordered_map<CacheKey, ::std::pair<bool, ::std::size_t>, ::boost::hash<CacheKey>> Cache;
+			
+			struct Pair
+			{
+				::std::size_t body;
+				
+				::rl::sg::Body* first;
+				
+				::rl::sg::Body* second;
+			};
+			
+			void clearCache();
+			
+			bool isCollidingPairs();
+			
+			bool isPairsOutdated() const;
+			
+			void updateCacheFrames();
+			
+			void updatePairs();
+			
+			Cache cache;
+			
+			/** Frames of obstacle bodies the cached results are valid for. */
+			::std::vector< ::rl::math::Transform, ::Eigen::aligned_allocator< ::rl::math::Transform>> cacheFrames;
+			
+			::std::size_t cacheHits;
+			
+			CacheKey cacheKey;
+			
+			/** Keys of cached entries in insertion order, pointing into the cache. */
+			::std::deque<const CacheKey*> cacheKeys;
+			
+			::std::size_t cacheMisses;
+			
+			::rl::math::Real cacheResolution;
+			
+			::std::size_t cacheSize;
+			
+			bool lastPairFirst;
+			
+			::std::size_t pair;
+			
+			::std::vector<Pair> pairs;
+			
+			::rl::sg::Model* pairsModel;
+			
+			::std::size_t pairsRevision;
+			
+			::rl::sg::Scene* pairsScene;
 			
+			::rl::sg::SimpleScene* simpleScene;
 		};
 	}
 }
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Statistics.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		constexpr ::std::size_t Statistics::PHASES;
+		
+		Statistics::Timer::Timer(Statistics* statistics, const Phase& phase, const ::std::size_t& count) :
+			count(count),
+			phase(phase),
+			statistics(statistics),
+			time()
+		{
+			if (nullptr != this->statistics)
+			{
+				this->time = ::std::chrono::steady_clock::now();
+			}
+		}
+		
+		Statistics::Timer::~Timer()
+		{
+			if (nullptr != this->statistics)
+			{
+				this->statistics->add(this->phase, ::std::chrono::steady_clock::now() - this->time, this->count);
+			}
+		}
+		
+		Statistics::Statistics() :
+			counts(),
+			durations()
+		{
+			this->clear();
+		}
+		
+		Statistics::~Statistics()
+		{
+		}
+		
+		void
+		Statistics::add(const Phase& phase, const ::std::chrono::steady_clock::duration& duration, const ::std::size_t& count)
+		{
+			this->counts[phase].fetch_add(count, ::std::memory_order_relaxed);
+			this->durations[phase].fetch_add(duration.count(), ::std::memory_order_relaxed);
+		}
+		
+		void
+		Statistics::clear()
+		{
+			for (::std::size_t i = 0; i < PHASES; ++i)
+			{
+				this->counts[i] = 0;
+				this->durations[i] = 0;
+			}
+		}
+		
+		::std::size_t
+		Statistics::getCount(const Phase& phase) const
+		{
+			return this->counts[phase];
+		}
+		
+		::std::chrono::steady_clock::duration
+		Statistics::getDuration(const Phase& phase) const
+		{
+			return ::std::chrono::steady_clock::duration(this->durations[phase]);
+		}
+		
+		const char*
+		Statistics::getName(const Phase& phase)
+		{
+			switch (phase)
+			{
+			case PHASE_COLLISION:
+				return "collision";
+			case PHASE_GRAPH:
+				return "graph";
+			case PHASE_NEAREST:
+				return "nearest";
+			case PHASE_SAMPLING:
+				return "sampling";
+			case PHASE_VERIFICATION:
+				return "verification";
+			default:
+				return "";
+			}
+		}
+		
+		void
+		Statistics::write(::std::ostream& stream) const
+		{
+			stream << "{";
+			
+			for (::std::size_t i = 0; i < PHASES; ++i)
+			{
+				Phase phase = static_cast<Phase>(i);
+				stream << (i > 0 ? ", " : "") << "\"" << getName(phase) << "\": {";
+				stream << "\"count\": " << this->getCount(phase) << ", ";
+				stream << "\"duration\": " << ::std::chrono::duration_cast< ::std::chrono::duration<double>>(this->getDuration(phase)).count();
+				stream << "}";
+			}
+			
+			stream << "}";
+		}
+	}
+}
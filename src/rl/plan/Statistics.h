@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_STATISTICS_H
+#define RL_PLAN_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <rl/plan/export.h>
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Per-phase counters and timings of a planner run.
+		 * 
+		 * Planners and models record into a Statistics object only if one is
+		 * assigned to their statistics member, otherwise instrumentation is
+		 * reduced to a null pointer test. Counters are atomic and may be shared
+		 * between threads.
+		 * 
+		 * Phases may be nested, e.g., collision queries during sampling or
+		 * verification. The duration of a nested phase is then included in
+		 * the duration of the enclosing phase as well, so durations must not
+		 * be summed up to obtain the total time of a run.
+		 */
+		class RL_PLAN_EXPORT Statistics
+		{
+		public:
+			enum Phase
+			{
+				/** Discrete collision queries of a model. */
+				PHASE_COLLISION,
+				/** Insertion of vertices and edges into graph or tree. */
+				PHASE_GRAPH,
+				/** Nearest neighbor and radius queries. */
+				PHASE_NEAREST,
+				/** Generation of samples. */
+				PHASE_SAMPLING,
+				/** Verification of edges. */
+				PHASE_VERIFICATION
+			};
+			
+			/**
+			 * Record count and duration of a scope.
+			 * 
+			 * Does nothing if constructed with a null pointer.
+			 */
+			class RL_PLAN_EXPORT Timer
+			{
+			public:
+				Timer(Statistics* statistics, const Phase& phase, const ::std::size_t& count = 1);
+				
+				~Timer();
+				
+			protected:
+				
+			private:
+				::std::size_t count;
+				
+				Phase phase;
+				
+				Statistics* statistics;
+				
+				::std::chrono::steady_clock::time_point time;
+			};
+			
+			Statistics();
+			
+			virtual ~Statistics();
+			
+			void add(const Phase& phase, const ::std::chrono::steady_clock::duration& duration, const ::std::size_t& count = 1);
+			
+			void clear();
+			
+			::std::size_t getCount(const Phase& phase) const;
+			
+			::std::chrono::steady_clock::duration getDuration(const Phase& phase) const;
+			
+			static const char* getName(const Phase& phase);
+			
+			/**
+			 * Write all counters as JSON object.
+			 * 
+			 * Every phase is written as member with count and duration in seconds,
+			 * e.g., <code>{"collision": {"count": 42, "duration": 0.001}, ...}</code>.
+			 */
+			void write(::std::ostream& stream) const;
+			
+			static constexpr ::std::size_t PHASES = PHASE_VERIFICATION + 1;
+			
+		protected:
+			
+		private:
+			::std::array< ::std::atomic< ::std::size_t>, PHASES> counts;
+			
+			::std::array< ::std::atomic< ::std::chrono::steady_clock::rep>, PHASES> durations;
+		};
+	}
+}
+
+#endif // RL_PLAN_STATISTICS_H
@@ -67,6 +67,7 @@ namespace rl
 		UniformSampler::seed(const ::std::mt19937::result_type& value)
 		{
 			this->randEngine.seed(value);
+			this->surplus.clear();
 		}
 	}
 }
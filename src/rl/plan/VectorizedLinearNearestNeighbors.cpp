@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Exception.h"
+#include "Model.h"
+#include "VectorizedLinearNearestNeighbors.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		VectorizedLinearNearestNeighbors::VectorizedLinearNearestNeighbors(Model* model) :
+			NearestNeighbors(true),
+			container()
+		{
+			if (model->getDof() != model->getDofPosition())
+			{
+				throw Exception("rl::plan::VectorizedLinearNearestNeighbors::VectorizedLinearNearestNeighbors() - Model with spherical joints not supported");
+			}
+			
+			::Eigen::Matrix<bool, ::Eigen::Dynamic, 1> wraparounds = model->getWraparounds();
+			::rl::math::Vector ranges = (model->getMaximum() - model->getMinimum()).cwiseAbs();
+			
+			for (::std::ptrdiff_t i = 0; i < ranges.size(); ++i)
+			{
+				if (!wraparounds(i))
+				{
+					ranges(i) = 0;
+				}
+			}
+			
+			this->container.setRanges(ranges);
+		}
+		
+		VectorizedLinearNearestNeighbors::~VectorizedLinearNearestNeighbors()
+		{
+		}
+		
+		void
+		VectorizedLinearNearestNeighbors::clear()
+		{
+			this->container.clear();
+		}
+		
+		bool
+		VectorizedLinearNearestNeighbors::empty() const
+		{
+			return this->container.empty();
+		}
+		
+		::std::vector<NearestNeighbors::Neighbor>
+		VectorizedLinearNearestNeighbors::nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted) const
+		{
+			return this->container.nearest(query, k, sorted);
+		}
+		
+		void
+		VectorizedLinearNearestNeighbors::push(const NearestNeighbors::Value& value)
+		{
+			this->container.push(value);
+		}
+		
+		::std::vector<NearestNeighbors::Neighbor>
+		VectorizedLinearNearestNeighbors::radius(const NearestNeighbors::Value& query, const Distance& radius, const bool& sorted) const
+		{
+			return this->container.radius(query, radius, sorted);
+		}
+		
+		::std::size_t
+		VectorizedLinearNearestNeighbors::size() const
+		{
+			return this->container.size();
+		}
+	}
+}
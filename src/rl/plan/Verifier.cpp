@@ -45,5 +45,18 @@ namespace rl
 		{
 			return static_cast< ::std::size_t>(::std::ceil(d / this->delta));
 		}
+		
+		::std::vector<bool>
+		Verifier::isColliding(const ::std::vector<Edge>& edges)
+		{
+			::std::vector<bool> colliding(edges.size());
+			
+			for (::std::size_t i = 0; i < edges.size(); ++i)
+			{
+				colliding[i] = this->isColliding(*edges[i].u, *edges[i].v, edges[i].d);
+			}
+			
+			return colliding;
+		}
 	}
 }
@@ -27,6 +27,7 @@
 #ifndef RL_PLAN_VERIFIER_H
 #define RL_PLAN_VERIFIER_H
 
+#include <vector>
 #include <rl/math/Vector.h>
 #include <rl/plan/export.h>
 
@@ -39,6 +40,19 @@ namespace rl
 		class RL_PLAN_EXPORT Verifier
 		{
 		public:
+			/** Straight-line edge between two configurations. */
+			struct Edge
+			{
+				/** Distance between configurations. */
+				::rl::math::Real d;
+				
+				/** Start configuration. */
+				const ::rl::math::Vector* u;
+				
+				/** End configuration. */
+				const ::rl::math::Vector* v;
+			};
+			
 			Verifier();
 			
 			virtual ~Verifier();
@@ -47,6 +61,15 @@ namespace rl
 			
 			virtual bool isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d) = 0;
 			
+			/**
+			 * Check a batch of edges.
+			 * 
+			 * The default implementation checks all edges one after another.
+			 * 
+			 * @return Collision status per edge
+			 */
+			virtual ::std::vector<bool> isColliding(const ::std::vector<Edge>& edges);
+			
 			::rl::math::Real delta;
 			
 			SimpleModel* model;
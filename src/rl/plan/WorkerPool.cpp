@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+
+#include "WorkerPool.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		WorkerPool::WorkerPool() :
+			condition(),
+			finished(),
+			generation(0),
+			job(nullptr),
+			models(),
+			mutex(),
+			pending(0),
+			stopped(false),
+			threads()
+		{
+		}
+		
+		WorkerPool::~WorkerPool()
+		{
+			this->stop();
+		}
+		
+		void
+		WorkerPool::run(const ::std::vector<SimpleModel*>& models, const ::std::function<void(SimpleModel*)>& job)
+		{
+			if (models.empty())
+			{
+				return;
+			}
+			
+			if (models != this->models)
+			{
+				this->stop();
+				this->models = models;
+				this->start();
+			}
+			
+			{
+				::std::lock_guard< ::std::mutex> lock(this->mutex);
+				this->job = &job;
+				this->pending = this->threads.size();
+				++this->generation;
+			}
+			
+			this->condition.notify_all();
+			
+			job(this->models[0]);
+			
+			::std::unique_lock< ::std::mutex> lock(this->mutex);
+			this->finished.wait(lock, [this]() { return 0 == this->pending; });
+			this->job = nullptr;
+		}
+		
+		void
+		WorkerPool::start()
+		{
+			this->stopped = false;
+			this->threads.reserve(this->models.size() - 1);
+			
+			for (::std::size_t i = 1; i < this->models.size(); ++i)
+			{
+				this->threads.push_back(::std::thread(&WorkerPool::work, this, i, this->generation));
+			}
+		}
+		
+		void
+		WorkerPool::stop()
+		{
+			{
+				::std::lock_guard< ::std::mutex> lock(this->mutex);
+				this->stopped = true;
+			}
+			
+			this->condition.notify_all();
+			
+			for (::std::size_t i = 0; i < this->threads.size(); ++i)
+			{
+				this->threads[i].join();
+			}
+			
+			this->threads.clear();
+		}
+		
+		void
+		WorkerPool::work(const ::std::size_t& i, ::std::size_t generation)
+		{
+			::std::unique_lock< ::std::mutex> lock(this->mutex);
+			
+			while (true)
+			{
+				this->condition.wait(lock, [this, generation]() { return this->stopped || generation != this->generation; });
+				
+				if (this->stopped)
+				{
+					return;
+				}
+				
+				generation = this->generation;
+				const ::std::function<void(SimpleModel*)>* job = this->job;
+				
+				lock.unlock();
+				(*job)(this->models[i]);
+				lock.lock();
+				
+				if (0 == --this->pending)
+				{
+					this->finished.notify_one();
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+
+#ifndef RL_PLAN_WORKERPOOL_H
+#define RL_PLAN_WORKERPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <rl/plan/export.h>
+
+namespace rl
+{
+	namespace plan
+	{
+		class SimpleModel;
+		
+		/**
+		 * Persistent threads running a job on one model each.
+		 * 
+		 * Threads are started on first use and kept until destruction or
+		 * until the models change, so that frequent small jobs do not pay for
+		 * thread creation.
+		 */
+		class RL_PLAN_EXPORT WorkerPool
+		{
+		public:
+			WorkerPool();
+			
+			virtual ~WorkerPool();
+			
+			/**
+			 * Run job on all models and wait for completion.
+			 * 
+			 * The first model is used on the calling thread, every other model
+			 * on its own worker thread.
+			 */
+			void run(const ::std::vector<SimpleModel*>& models, const ::std::function<void(SimpleModel*)>& job);
+			
+		protected:
+			
+		private:
+			void start();
+			
+			void stop();
+			
+			void work(const ::std::size_t& i, ::std::size_t generation);
+			
+			::std::condition_variable condition;
+			
+			::std::condition_variable finished;
+			
+			::std::size_t generation;
+			
+			const ::std::function<void(SimpleModel*)>* job;
+			
+			::std::vector<SimpleModel*> models;
+			
+			::std::mutex mutex;
+			
+			::std::size_t pending;
+			
+			bool stopped;
+			
+			::std::vector< ::std::thread> threads;
+		};
+	}
+}
+
+#endif // RL_PLAN_WORKERPOOL_H
@@ -0,0 +1,440 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cassert>
+
+#include "AabbTree.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		const ::std::size_t AabbTree::Null = ::std::numeric_limits< ::std::size_t>::max();
+		
+		AabbTree::AabbTree() :
+			free(),
+			leaves(0),
+			margin(0),
+			nodes(),
+			root(Null)
+		{
+		}
+		
+		AabbTree::~AabbTree()
+		{
+		}
+		
+		::std::size_t
+		AabbTree::allocate()
+		{
+			if (!this->free.empty())
+			{
+				::std::size_t node = this->free.back();
+				this->free.pop_back();
+				this->nodes[node] = Node();
+				return node;
+			}
+			
+			this->nodes.push_back(Node());
+			return this->nodes.size() - 1;
+		}
+		
+		::rl::math::Real
+		AabbTree::Area(const ::rl::math::AlignedBox3& box)
+		{
+			::rl::math::Vector3 sizes = box.sizes();
+			return 2 * (sizes.x() * sizes.y() + sizes.y() * sizes.z() + sizes.z() * sizes.x());
+		}
+		
+		::std::size_t
+		AabbTree::balance(const ::std::size_t& a)
+		{
+			if (this->nodes[a].isLeaf() || this->nodes[a].height < 2)
+			{
+				return a;
+			}
+			
+			::std::size_t b = this->nodes[a].children[0];
+			::std::size_t c = this->nodes[a].children[1];
+			
+			// rotate higher child up, higher grandchild stays below it
+			for (::std::size_t i = 0; i < 2; ++i)
+			{
+				::std::size_t up = 0 == i ? c : b;
+				::std::size_t other = 0 == i ? b : c;
+				
+				if (this->nodes[up].height <= this->nodes[other].height + 1)
+				{
+					continue;
+				}
+				
+				::std::size_t f = this->nodes[up].children[0];
+				::std::size_t g = this->nodes[up].children[1];
+				::std::size_t high = this->nodes[f].height > this->nodes[g].height ? f : g;
+				::std::size_t low = this->nodes[f].height > this->nodes[g].height ? g : f;
+				
+				this->nodes[up].parent = this->nodes[a].parent;
+				this->nodes[a].parent = up;
+				
+				if (Null == this->nodes[up].parent)
+				{
+					this->root = up;
+				}
+				else if (this->nodes[this->nodes[up].parent].children[0] == a)
+				{
+					this->nodes[this->nodes[up].parent].children[0] = up;
+				}
+				else
+				{
+					this->nodes[this->nodes[up].parent].children[1] = up;
+				}
+				
+				this->nodes[up].children[0] = a;
+				this->nodes[up].children[1] = high;
+				this->nodes[a].children[0 == i ? 1 : 0] = low;
+				this->nodes[low].parent = a;
+				
+				this->nodes[a].box = this->nodes[other].box;
+				this->nodes[a].box.extend(this->nodes[low].box);
+				this->nodes[a].height = 1 + ::std::max(this->nodes[other].height, this->nodes[low].height);
+				
+				this->nodes[up].box = this->nodes[a].box;
+				this->nodes[up].box.extend(this->nodes[high].box);
+				this->nodes[up].height = 1 + ::std::max(this->nodes[a].height, this->nodes[high].height);
+				
+				return up;
+			}
+			
+			return a;
+		}
+		
+		void
+		AabbTree::clear()
+		{
+			this->free.clear();
+			this->leaves = 0;
+			this->nodes.clear();
+			this->root = Null;
+		}
+		
+		void
+		AabbTree::deallocate(const ::std::size_t& node)
+		{
+			this->nodes[node].data = nullptr;
+			this->nodes[node].height = Null;
+			this->free.push_back(node);
+		}
+		
+		bool
+		AabbTree::empty() const
+		{
+			return Null == this->root;
+		}
+		
+		const ::rl::math::AlignedBox3&
+		AabbTree::getBox(const ::std::size_t& leaf) const
+		{
+			return this->nodes[leaf].box;
+		}
+		
+		void*
+		AabbTree::getData(const ::std::size_t& leaf) const
+		{
+			return this->nodes[leaf].data;
+		}
+		
+		::std::size_t
+		AabbTree::getHeight() const
+		{
+			return Null == this->root ? 0 : this->nodes[this->root].height;
+		}
+		
+		::rl::math::Real
+		AabbTree::getMargin() const
+		{
+			return this->margin;
+		}
+		
+		::std::size_t
+		AabbTree::insert(const ::rl::math::AlignedBox3& box, void* data)
+		{
+			::std::size_t leaf = this->allocate();
+			this->nodes[leaf].box.min() = box.min().array() - this->margin;
+			this->nodes[leaf].box.max() = box.max().array() + this->margin;
+			this->nodes[leaf].data = data;
+			this->nodes[leaf].height = 0;
+			this->insertLeaf(leaf);
+			++this->leaves;
+			return leaf;
+		}
+		
+		void
+		AabbTree::insertLeaf(const ::std::size_t& leaf)
+		{
+			if (Null == this->root)
+			{
+				this->root = leaf;
+				this->nodes[leaf].parent = Null;
+				return;
+			}
+			
+			// descend to sibling with lowest increase of surface area
+			
+			const ::rl::math::AlignedBox3& box = this->nodes[leaf].box;
+			::std::size_t sibling = this->root;
+			
+			while (!this->nodes[sibling].isLeaf())
+			{
+				::rl::math::AlignedBox3 combined = this->nodes[sibling].box;
+				combined.extend(box);
+				::rl::math::Real cost = 2 * Area(combined);
+				::rl::math::Real inheritance = 2 * (Area(combined) - Area(this->nodes[sibling].box));
+				
+				::std::array< ::rl::math::Real, 2> costs;
+				
+				for (::std::size_t i = 0; i < 2; ++i)
+				{
+					const Node& child = this->nodes[this->nodes[sibling].children[i]];
+					::rl::math::AlignedBox3 merged = child.box;
+					merged.extend(box);
+					costs[i] = Area(merged) + inheritance - (child.isLeaf() ? 0 : Area(child.box));
+				}
+				
+				if (cost < costs[0] && cost < costs[1])
+				{
+					break;
+				}
+				
+				sibling = this->nodes[sibling].children[costs[0] < costs[1] ? 0 : 1];
+			}
+			
+			::std::size_t parent = this->allocate();
+			::std::size_t grandparent = this->nodes[sibling].parent;
+			
+			this->nodes[parent].parent = grandparent;
+			this->nodes[parent].children[0] = sibling;
+			this->nodes[parent].children[1] = leaf;
+			this->nodes[parent].box = this->nodes[sibling].box;
+			this->nodes[parent].box.extend(this->nodes[leaf].box);
+			this->nodes[parent].height = this->nodes[sibling].height + 1;
+			
+			if (Null == grandparent)
+			{
+				this->root = parent;
+			}
+			else if (this->nodes[grandparent].children[0] == sibling)
+			{
+				this->nodes[grandparent].children[0] = parent;
+			}
+			else
+			{
+				this->nodes[grandparent].children[1] = parent;
+			}
+			
+			this->nodes[sibling].parent = parent;
+			this->nodes[leaf].parent = parent;
+			
+			this->refit(grandparent);
+		}
+		
+		void
+		AabbTree::overlap(const ::rl::math::AlignedBox3& box, ::std::vector<void*>& data) const
+		{
+			data.clear();
+			
+			if (Null == this->root)
+			{
+				return;
+			}
+			
+			::std::vector< ::std::size_t> stack(1, this->root);
+			
+			while (!stack.empty())
+			{
+				const Node& node = this->nodes[stack.back()];
+				stack.pop_back();
+				
+				if (node.box.intersects(box))
+				{
+					if (node.isLeaf())
+					{
+						data.push_back(node.data);
+					}
+					else
+					{
+						stack.push_back(node.children[0]);
+						stack.push_back(node.children[1]);
+					}
+				}
+			}
+		}
+		
+		void
+		AabbTree::overlap(::std::vector< ::std::pair<void*, void*>>& pairs) const
+		{
+			pairs.clear();
+			
+			::std::vector< ::std::size_t> stack;
+			
+			for (::std::size_t i = 0; i < this->nodes.size(); ++i)
+			{
+				if (!this->nodes[i].isLeaf() || Null == this->nodes[i].height)
+				{
+					continue;
+				}
+				
+				stack.assign(1, this->root);
+				
+				while (!stack.empty())
+				{
+					::std::size_t index = stack.back();
+					const Node& node = this->nodes[index];
+					stack.pop_back();
+					
+					if (node.box.intersects(this->nodes[i].box))
+					{
+						if (node.isLeaf())
+						{
+							if (index > i)
+							{
+								pairs.push_back(::std::make_pair(this->nodes[i].data, node.data));
+							}
+						}
+						else
+						{
+							stack.push_back(node.children[0]);
+							stack.push_back(node.children[1]);
+						}
+					}
+				}
+			}
+		}
+		
+		void
+		AabbTree::refit(::std::size_t node)
+		{
+			while (Null != node)
+			{
+				node = this->balance(node);
+				
+				const Node& child0 = this->nodes[this->nodes[node].children[0]];
+				const Node& child1 = this->nodes[this->nodes[node].children[1]];
+				
+				this->nodes[node].box = child0.box;
+				this->nodes[node].box.extend(child1.box);
+				this->nodes[node].height = 1 + ::std::max(child0.height, child1.height);
+				
+				node = this->nodes[node].parent;
+			}
+		}
+		
+		void
+		AabbTree::remove(const ::std::size_t& leaf)
+		{
+			assert(this->nodes[leaf].isLeaf());
+			
+			this->removeLeaf(leaf);
+			this->deallocate(leaf);
+			--this->leaves;
+		}
+		
+		void
+		AabbTree::removeLeaf(const ::std::size_t& leaf)
+		{
+			if (this->root == leaf)
+			{
+				this->root = Null;
+				return;
+			}
+			
+			::std::size_t parent = this->nodes[leaf].parent;
+			::std::size_t grandparent = this->nodes[parent].parent;
+			::std::size_t sibling = this->nodes[parent].children[this->nodes[parent].children[0] == leaf ? 1 : 0];
+			
+			this->nodes[sibling].parent = grandparent;
+			
+			if (Null == grandparent)
+			{
+				this->root = sibling;
+			}
+			else if (this->nodes[grandparent].children[0] == parent)
+			{
+				this->nodes[grandparent].children[0] = sibling;
+			}
+			else
+			{
+				this->nodes[grandparent].children[1] = sibling;
+			}
+			
+			this->deallocate(parent);
+			this->refit(grandparent);
+		}
+		
+		void
+		AabbTree::setMargin(const ::rl::math::Real& margin)
+		{
+			this->margin = margin;
+		}
+		
+		::std::size_t
+		AabbTree::size() const
+		{
+			return this->leaves;
+		}
+		
+		bool
+		AabbTree::update(const ::std::size_t& leaf, const ::rl::math::AlignedBox3& box)
+		{
+			if (this->nodes[leaf].box.contains(box))
+			{
+				return false;
+			}
+			
+			this->removeLeaf(leaf);
+			this->nodes[leaf].box.min() = box.min().array() - this->margin;
+			this->nodes[leaf].box.max() = box.max().array() + this->margin;
+			this->insertLeaf(leaf);
+			return true;
+		}
+		
+		AabbTree::Node::Node() :
+			box(),
+			children(),
+			data(nullptr),
+			height(0),
+			parent(AabbTree::Null)
+		{
+			this->children.fill(AabbTree::Null);
+		}
+		
+		bool
+		AabbTree::Node::isLeaf() const
+		{
+			return AabbTree::Null == this->children[0];
+		}
+	}
+}
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_SG_AABBTREE_H
+#define RL_SG_AABBTREE_H
+
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <rl/math/AlignedBox.h>
+#include <rl/math/Real.h>
+#include <rl/math/Vector.h>
+
+#include "Base.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		/**
+		 * Dynamic axis-aligned bounding box tree.
+		 * 
+		 * Broadphase for collision queries, leaves store enlarged boxes of
+		 * objects and are only reinserted when an object leaves its enlarged
+		 * box. The tree is kept balanced by rotations on insertion and
+		 * removal.
+		 * 
+		 * Erin Catto. Dynamic bounding volume hierarchies. Game Developers
+		 * Conference, 2019.
+		 */
+		class RL_SG_EXPORT AabbTree
+		{
+		public:
+			AabbTree();
+			
+			virtual ~AabbTree();
+			
+			void clear();
+			
+			bool empty() const;
+			
+			/**
+			 * Enlarged box of a leaf.
+			 */
+			const ::rl::math::AlignedBox3& getBox(const ::std::size_t& leaf) const;
+			
+			void* getData(const ::std::size_t& leaf) const;
+			
+			/**
+			 * Maximum depth of leaves.
+			 */
+			::std::size_t getHeight() const;
+			
+			::rl::math::Real getMargin() const;
+			
+			/**
+			 * Insert an object with its bounding box.
+			 * 
+			 * @return Leaf of object, valid until it is removed
+			 */
+			::std::size_t insert(const ::rl::math::AlignedBox3& box, void* data);
+			
+			/**
+			 * Find all objects whose boxes overlap a box.
+			 */
+			void overlap(const ::rl::math::AlignedBox3& box, ::std::vector<void*>& data) const;
+			
+			/**
+			 * Find all pairs of objects with overlapping boxes.
+			 */
+			void overlap(::std::vector< ::std::pair<void*, void*>>& pairs) const;
+			
+			void remove(const ::std::size_t& leaf);
+			
+			/**
+			 * Set enlargement of boxes stored in leaves.
+			 * 
+			 * Larger margins avoid reinsertion of moving objects, but report
+			 * more overlaps. Applies to subsequently inserted or moved objects.
+			 */
+			void setMargin(const ::rl::math::Real& margin);
+			
+			::std::size_t size() const;
+			
+			/**
+			 * Update bounding box of an object.
+			 * 
+			 * @return True if the leaf was reinserted
+			 */
+			bool update(const ::std::size_t& leaf, const ::rl::math::AlignedBox3& box);
+			
+		protected:
+			
+		private:
+			struct Node
+			{
+				EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+				
+				Node();
+				
+				bool isLeaf() const;
+				
+				::rl::math::AlignedBox3 box;
+				
+				::std::array< ::std::size_t, 2> children;
+				
+				void* data;
+				
+				::std::size_t height;
+				
+				::std::size_t parent;
+			};
+			
+			static ::rl::math::Real Area(const ::rl::math::AlignedBox3& box);
+			
+			static const ::std::size_t Null;
+			
+			::std::size_t allocate();
+			
+			::std::size_t balance(const ::std::size_t& a);
+			
+			void deallocate(const ::std::size_t& node);
+			
+			void insertLeaf(const ::std::size_t& leaf);
+			
+			void refit(::std::size_t node);
+			
+			void removeLeaf(const ::std::size_t& leaf);
+			
+			::std::vector< ::std::size_t> free;
+			
+			::std::size_t leaves;
+			
+			::rl::math::Real margin;
+			
+			::std::vector<Node, ::Eigen::aligned_allocator<Node>> nodes;
+			
+			::std::size_t root;
+		};
+	}
+}
+
+#endif // RL_SG_AABBTREE_H
@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Body.h"
+#include "ContinuousScene.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		ContinuousScene::ContinuousScene() :
+			Scene()
+		{
+		}
+		
+		ContinuousScene::~ContinuousScene()
+		{
+		}
+		
+		bool
+		ContinuousScene::areColliding(Body* first, const ::rl::math::Transform& frame1, Body* second, const ::rl::math::Transform& frame2)
+		{
+			for (Body::Iterator i = first->begin(); i != first->end(); ++i)
+			{
+				for (Body::Iterator j = second->begin(); j != second->end(); ++j)
+				{
+					if (this->areColliding(*i, frame1, *j, frame2))
+					{
+						return true;
+					}
+				}
+			}
+			
+			return false;
+		}
+	}
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_SG_CONTINUOUSSCENE_H
+#define RL_SG_CONTINUOUSSCENE_H
+
+#include <rl/math/Transform.h>
+
+#include "Scene.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		class Body;
+		class Shape;
+		
+		/**
+		 * Scene supporting continuous collision queries.
+		 * 
+		 * Bodies move from their current frames to the specified frames along
+		 * a screw motion, i.e., a constant rotation about and translation along
+		 * a fixed axis. This is exact for bodies moved by a single joint.
+		 */
+		class RL_SG_EXPORT ContinuousScene : public virtual Scene
+		{
+		public:
+			ContinuousScene();
+			
+			virtual ~ContinuousScene();
+			
+			/**
+			 * Check if bodies collide during motion.
+			 * 
+			 * @param[in] frame1 Frame of first body at end of motion
+			 * @param[in] frame2 Frame of second body at end of motion
+			 */
+			virtual bool areColliding(Body* first, const ::rl::math::Transform& frame1, Body* second, const ::rl::math::Transform& frame2);
+			
+			/**
+			 * Check if shapes collide during motion.
+			 * 
+			 * @param[in] frame1 Frame of body of first shape at end of motion
+			 * @param[in] frame2 Frame of body of second shape at end of motion
+			 */
+			virtual bool areColliding(Shape* first, const ::rl::math::Transform& frame1, Shape* second, const ::rl::math::Transform& frame2) = 0;
+			
+		protected:
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_SG_CONTINUOUSSCENE_H
@@ -53,6 +53,7 @@ namespace rl
 		Model::add(Body* body)
 		{
 			this->bodies.push_back(body);
+			++this->scene->revision;
 		}
 		
 		Model::Iterator
@@ -99,6 +100,7 @@ namespace rl
 			if (found != this->bodies.end())
 			{
 				this->bodies.erase(found);
+				++this->scene->revision;
 			}
 		}
 		
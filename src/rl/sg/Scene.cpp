@@ -35,7 +35,8 @@ namespace rl
 		Scene::Scene() :
 			Base(),
 			models(),
-			name()
+			name(),
+			revision(0)
 		{
 		}
 		
@@ -47,6 +48,7 @@ namespace rl
 		Scene::add(Model* model)
 		{
 			this->models.push_back(model);
+			++this->revision;
 		}
 		
 		Scene::Iterator
@@ -79,6 +81,12 @@ namespace rl
 			return this->models.size();
 		}
 		
+		::std::size_t
+		Scene::getRevision() const
+		{
+			return this->revision;
+		}
+		
 		bool
 		Scene::isScalingSupported() const
 		{
@@ -93,6 +101,7 @@ namespace rl
 			if (found != this->models.end())
 			{
 				this->models.erase(found);
+				++this->revision;
 			}
 		}
 		
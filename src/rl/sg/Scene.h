@@ -64,6 +64,14 @@ namespace rl
 			
 			::std::size_t getNumModels() const;
 			
+			/**
+			 * Number of structural changes of the scene.
+			 * 
+			 * Increased when models are added to or removed from the scene
+			 * and when bodies are added to or removed from its models.
+			 */
+			::std::size_t getRevision() const;
+			
 			virtual bool isScalingSupported() const;
 			
 			virtual void remove(Model* model);
@@ -74,7 +82,11 @@ namespace rl
 			::std::vector<Model*> models;
 			
 		private:
+			friend class Model;
+			
 			::std::string name;
+			
+			::std::size_t revision;
 		};
 	}
 }
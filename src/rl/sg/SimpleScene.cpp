@@ -33,7 +33,9 @@ namespace rl
 	namespace sg
 	{
 		SimpleScene::SimpleScene() :
-			Scene()
+			Scene(),
+			aabbTree(),
+			leaves()
 		{
 		}
 		
@@ -44,6 +46,22 @@ namespace rl
 		bool
 		SimpleScene::areColliding(Body* first, Body* second)
 		{
+			if (nullptr != this->aabbTree)
+			{
+				::std::unordered_map<Body*, ::std::size_t>::const_iterator leaf1 = this->leaves.find(first);
+				::std::unordered_map<Body*, ::std::size_t>::const_iterator leaf2 = this->leaves.find(second);
+				
+				if (this->leaves.end() == leaf1 || this->leaves.end() == leaf2)
+				{
+					return false;
+				}
+				
+				if (!this->aabbTree->getBox(leaf1->second).intersects(this->aabbTree->getBox(leaf2->second)))
+				{
+					return false;
+				}
+			}
+			
 			for (Body::Iterator i = first->begin(); i != first->end(); ++i)
 			{
 				for (Body::Iterator j = second->begin(); j != second->end(); ++j)
@@ -75,9 +93,34 @@ namespace rl
 			return false;
 		}
 		
+		::rl::math::Real
+		SimpleScene::getBoundingBoxMargin() const
+		{
+			return nullptr != this->aabbTree ? this->aabbTree->getMargin() : 0;
+		}
+		
 		bool
 		SimpleScene::isColliding()
 		{
+			if (nullptr != this->aabbTree)
+			{
+				::std::vector< ::std::pair<void*, void*>> pairs;
+				this->aabbTree->overlap(pairs);
+				
+				for (::std::size_t i = 0; i < pairs.size(); ++i)
+				{
+					Body* first = static_cast<Body*>(pairs[i].first);
+					Body* second = static_cast<Body*>(pairs[i].second);
+					
+					if (first->getModel() != second->getModel() && this->areColliding(first, second))
+					{
+						return true;
+					}
+				}
+				
+				return false;
+			}
+			
 			for (Scene::Iterator i = this->begin(); i != this->end() - 1; ++i)
 			{
 				for (Scene::Iterator j = i + 1; j != this->end(); ++j)
@@ -91,5 +134,57 @@ namespace rl
 			
 			return false;
 		}
+		
+		void
+		SimpleScene::removeBoundingBox(Body* body)
+		{
+			if (nullptr == this->aabbTree)
+			{
+				return;
+			}
+			
+			::std::unordered_map<Body*, ::std::size_t>::iterator leaf = this->leaves.find(body);
+			
+			if (this->leaves.end() != leaf)
+			{
+				this->aabbTree->remove(leaf->second);
+				this->leaves.erase(leaf);
+			}
+		}
+		
+		void
+		SimpleScene::setBoundingBoxMargin(const ::rl::math::Real& margin)
+		{
+			if (nullptr != this->aabbTree)
+			{
+				this->aabbTree->setMargin(margin);
+			}
+		}
+		
+		void
+		SimpleScene::updateBoundingBox(Body* body, const ::rl::math::AlignedBox3& box)
+		{
+			if (nullptr == this->aabbTree)
+			{
+				return;
+			}
+			
+			if (box.isEmpty())
+			{
+				this->removeBoundingBox(body);
+				return;
+			}
+			
+			::std::unordered_map<Body*, ::std::size_t>::iterator leaf = this->leaves.find(body);
+			
+			if (this->leaves.end() != leaf)
+			{
+				this->aabbTree->update(leaf->second, box);
+			}
+			else
+			{
+				this->leaves[body] = this->aabbTree->insert(box, body);
+			}
+		}
 	}
 }
@@ -27,6 +27,11 @@
 #ifndef RL_SG_SIMPLESCENE_H
 #define RL_SG_SIMPLESCENE_H
 
+#include <memory>
+#include <unordered_map>
+#include <rl/math/AlignedBox.h>
+
+#include "AabbTree.h"
 #include "Scene.h"
 
 namespace rl
@@ -50,12 +55,48 @@ namespace rl
 			
 			virtual bool areColliding(Shape* first, Shape* second) = 0;
 			
+			/**
+			 * Enlargement of bounding boxes in broadphase.
+			 * 
+			 * @return Zero if the backend does not use a broadphase
+			 */
+			::rl::math::Real getBoundingBoxMargin() const;
+			
 			virtual bool isColliding();
 			
+			/**
+			 * Remove body from broadphase.
+			 */
+			void removeBoundingBox(Body* body);
+			
+			/**
+			 * Set enlargement of bounding boxes in broadphase.
+			 * 
+			 * Larger margins avoid updates of the broadphase for moving bodies,
+			 * but report more pairs of bodies to the narrowphase. Applies to
+			 * bodies that are inserted or leave their enlarged box afterwards.
+			 * Has no effect if the backend does not use a broadphase.
+			 */
+			void setBoundingBoxMargin(const ::rl::math::Real& margin);
+			
+			/**
+			 * Update axis-aligned bounding box of body in world coordinates.
+			 * 
+			 * Has no effect if the backend does not use a broadphase, an empty
+			 * box removes the body from the broadphase.
+			 */
+			void updateBoundingBox(Body* body, const ::rl::math::AlignedBox3& box);
+			
 		protected:
+			/**
+			 * Optional broadphase, enabled by backends that provide bounding boxes.
+			 * 
+			 * Pairs of bodies with disjoint boxes are skipped in collision queries.
+			 */
+			::std::unique_ptr<AabbTree> aabbTree;
 			
 		private:
-			
+			::std::unordered_map<Body*, ::std::size_t> leaves;
 		};
 	}
 }
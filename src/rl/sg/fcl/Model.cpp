@@ -55,7 +55,7 @@ namespace rl
 			void
 			Model::add(Body* body)
 			{
-				this->bodies.push_back(body);
+				::rl::sg::Model::add(body);
 				::std::vector< ::fcl::CollisionObject*> objects;
 				body->manager.getObjects(objects);
 				
@@ -86,7 +86,7 @@ namespace rl
 			
 				if (found != this->bodies.end())
 				{
-					this->bodies.erase(found);
+					::rl::sg::Model::remove(body);
 					::std::vector< ::fcl::CollisionObject*> objects;
 					body->manager.getObjects(objects);
 					
@@ -24,6 +24,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <fcl/continuous_collision.h>
 #include <fcl/distance.h>
 #include <fcl/BVH/BVH_model.h>
 
@@ -45,6 +46,9 @@ namespace rl
 		{
 			Scene::Scene() :
 				::rl::sg::Scene(),
+				::rl::sg::ContinuousScene(),
+				::rl::sg::DepthScene(),
+				::rl::sg::DistanceScene(),
 				::rl::sg::SimpleScene(),
 				manager()
 			{
@@ -63,7 +67,7 @@ namespace rl
 			Scene::add(::rl::sg::Model* model)
 			{
 				Model* modelFcl = static_cast<Model*>(model);
-				this->models.push_back(model);
+				::rl::sg::Scene::add(model);
 				::std::vector< ::fcl::CollisionObject*> objects;
 				modelFcl->manager.getObjects(objects);
 				
@@ -121,6 +125,31 @@ namespace rl
 				return result.isCollision();
 			}
 			
+			bool
+			Scene::areColliding(::rl::sg::Shape* first, const ::rl::math::Transform& frame1, ::rl::sg::Shape* second, const ::rl::math::Transform& frame2)
+			{
+				Shape* shape1 = static_cast<Shape*>(first);
+				Shape* shape2 = static_cast<Shape*>(second);
+				
+				::fcl::Transform3f transform1;
+				shape1->getTransform(frame1, transform1);
+				
+				::fcl::Transform3f transform2;
+				shape2->getTransform(frame2, transform2);
+				
+				::fcl::ContinuousCollisionRequest request(
+					10,
+					static_cast< ::fcl::FCL_REAL>(0.0001),
+					::fcl::CCDM_SCREW,
+					::fcl::GST_LIBCCD,
+					::fcl::CCDC_CONSERVATIVE_ADVANCEMENT
+				);
+				::fcl::ContinuousCollisionResult result;
+				::fcl::continuousCollide(shape1->collisionObject.get(), transform1, shape2->collisionObject.get(), transform2, request, result);
+				
+				return result.is_collide;
+			}
+			
 			::rl::sg::Model*
 			Scene::create()
 			{
@@ -330,7 +359,7 @@ namespace rl
 				
 				if (found != this->models.end())
 				{
-					this->models.erase(found);
+					::rl::sg::Scene::remove(model);
 					::std::vector< ::fcl::CollisionObject*> objects;
 					static_cast<Model*>(model)->manager.getObjects(objects);
 					
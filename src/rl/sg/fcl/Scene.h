@@ -31,6 +31,7 @@
 #include <fcl/collision.h>
 #include <fcl/broadphase/broadphase.h>
 
+#include "../ContinuousScene.h"
 #include "../DepthScene.h"
 #include "../DistanceScene.h"
 #include "../SimpleScene.h"
@@ -46,7 +47,7 @@ namespace rl
 		 */
 		namespace fcl
 		{
-			class RL_SG_EXPORT Scene : public ::rl::sg::DepthScene, public ::rl::sg::DistanceScene, public ::rl::sg::SimpleScene
+			class RL_SG_EXPORT Scene : public ::rl::sg::ContinuousScene, public ::rl::sg::DepthScene, public ::rl::sg::DistanceScene, public ::rl::sg::SimpleScene
 			{
 			public:
 				Scene();
@@ -57,12 +58,16 @@ namespace rl
 				
 				void addCollisionObject(::fcl::CollisionObject* collisionObject, Body* body);
 				
+				using ::rl::sg::ContinuousScene::areColliding;
+				
 				bool areColliding(::rl::sg::Body* first, ::rl::sg::Body* second);
 				
 				bool areColliding(::rl::sg::Model* first, ::rl::sg::Model* second);
 				
 				bool areColliding(::rl::sg::Shape* first, ::rl::sg::Shape* second);
 				
+				bool areColliding(::rl::sg::Shape* first, const ::rl::math::Transform& frame1, ::rl::sg::Shape* second, const ::rl::math::Transform& frame2);
+				
 				::rl::sg::Model* create();
 				
 				::rl::math::Real depth(::rl::sg::Shape* first, ::rl::sg::Shape* second, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2);
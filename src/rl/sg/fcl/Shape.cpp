@@ -204,6 +204,22 @@ namespace rl
 				transform = this->transform;
 			}
 			
+			void
+			Shape::getTransform(const ::rl::math::Transform& frame, ::fcl::Transform3f& transform) const
+			{
+				::rl::math::Transform fullTransform = frame * this->transform * this->baseTransform;
+				
+				::fcl::Vec3f translation(fullTransform(0, 3), fullTransform(1, 3), fullTransform(2, 3));
+				
+				::fcl::Matrix3f rotation(
+					fullTransform(0, 0), fullTransform(0, 1), fullTransform(0, 2),
+					fullTransform(1, 0), fullTransform(1, 1), fullTransform(1, 2),
+					fullTransform(2, 0), fullTransform(2, 1), fullTransform(2, 2)
+				);
+				
+				transform.setTransform(rotation, translation);
+			}
+			
 			void
 			Shape::setTransform(const ::rl::math::Transform& transform)
 			{
@@ -234,17 +250,10 @@ namespace rl
 			{
 				this->currentFrame = frame;
 				
-				::rl::math::Transform fullTransform = this->currentFrame * this->transform * this->baseTransform;
-				
-				::fcl::Vec3f translation(fullTransform(0, 3), fullTransform(1, 3), fullTransform(2, 3));
-				
-				::fcl::Matrix3f rotation(
-					fullTransform(0, 0), fullTransform(0, 1), fullTransform(0, 2),
-					fullTransform(1, 0), fullTransform(1, 1), fullTransform(1, 2),
-					fullTransform(2, 0), fullTransform(2, 1), fullTransform(2, 2)
-				);
+				::fcl::Transform3f transform;
+				this->getTransform(this->currentFrame, transform);
 				
-				this->collisionObject->setTransform(rotation, translation);
+				this->collisionObject->setTransform(transform);
 				this->collisionObject->computeAABB();
 			}
 		}
@@ -48,6 +48,11 @@ namespace rl
 				
 				void getTransform(::rl::math::Transform& transform);
 				
+				/**
+				 * Transform of collision object for a frame of the body.
+				 */
+				void getTransform(const ::rl::math::Transform& frame, ::fcl::Transform3f& transform) const;
+				
 				void setTransform(const ::rl::math::Transform& transform);
 				
 				void update(const ::rl::math::Transform& frame);
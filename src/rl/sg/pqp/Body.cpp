@@ -26,6 +26,7 @@
 
 #include "Body.h"
 #include "Model.h"
+#include "Scene.h"
 #include "Shape.h"
 
 namespace rl
@@ -72,6 +73,23 @@ namespace rl
 				{
 					static_cast<Shape*>(*i)->update();
 				}
+				
+				this->update();
+			}
+			
+			void
+			Body::update()
+			{
+				::rl::math::AlignedBox3 box;
+				
+				for (Iterator i = this->begin(); i != this->end(); ++i)
+				{
+					::rl::math::AlignedBox3 shape;
+					static_cast<Shape*>(*i)->getBoundingBox(shape);
+					box.extend(shape);
+				}
+				
+				dynamic_cast<Scene*>(this->getModel()->getScene())->updateBoundingBox(this, box);
 			}
 		}
 	}
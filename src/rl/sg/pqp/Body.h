@@ -52,6 +52,11 @@ namespace rl
 				
 				void setFrame(const ::rl::math::Transform& frame);
 				
+				/**
+				 * Update bounding box of body in broadphase of scene.
+				 */
+				void update();
+				
 				::rl::math::Transform frame;
 				
 			protected:
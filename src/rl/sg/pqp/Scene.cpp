@@ -39,6 +39,8 @@ namespace rl
 				::rl::sg::DistanceScene(),
 				::rl::sg::SimpleScene()
 			{
+				this->aabbTree.reset(new AabbTree());
+				this->aabbTree->setMargin(static_cast< ::rl::math::Real>(0.1));
 			}
 			
 			Scene::~Scene()
@@ -46,6 +46,7 @@ namespace rl
 			Shape::Shape(::SoVRMLShape* shape, Body* body) :
 				::rl::sg::Shape(shape, body),
 				model(),
+				box(),
 				frame(::rl::math::Transform::Identity()),
 				transform(::rl::math::Transform::Identity())
 			{
@@ -77,12 +78,38 @@ namespace rl
 				
 				this->model.EndModel();
 				
+				for (int i = 0; i < this->model.num_tris; ++i)
+				{
+					this->box.extend(::rl::math::Vector3(this->model.tris[i].p1[0], this->model.tris[i].p1[1], this->model.tris[i].p1[2]));
+					this->box.extend(::rl::math::Vector3(this->model.tris[i].p2[0], this->model.tris[i].p2[1], this->model.tris[i].p2[2]));
+					this->box.extend(::rl::math::Vector3(this->model.tris[i].p3[0], this->model.tris[i].p3[1], this->model.tris[i].p3[2]));
+				}
+				
 				this->getBody()->add(this);
+				
+				static_cast<Body*>(this->getBody())->update();
 			}
 			
 			Shape::~Shape()
 			{
 				this->getBody()->remove(this);
+				
+				static_cast<Body*>(this->getBody())->update();
+			}
+			
+			void
+			Shape::getBoundingBox(::rl::math::AlignedBox3& box) const
+			{
+				if (this->box.isEmpty())
+				{
+					box.setEmpty();
+					return;
+				}
+				
+				::rl::math::Vector3 center = this->frame * this->box.center();
+				::rl::math::Vector3 extent = this->frame.linear().cwiseAbs() * (this->box.sizes() / 2);
+				box.min() = center - extent;
+				box.max() = center + extent;
 			}
 			
 			void
@@ -97,6 +124,8 @@ namespace rl
 				this->transform = transform;
 				
 				this->update();
+				
+				static_cast<Body*>(this->getBody())->update();
 			}
 			
 			void
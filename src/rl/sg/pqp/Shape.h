@@ -32,6 +32,7 @@
 #include <Inventor/actions/SoCallbackAction.h>
 #include <Inventor/fields/SoMFInt32.h>
 #include <Inventor/fields/SoMFVec3f.h>
+#include <rl/math/AlignedBox.h>
 
 #include "../Shape.h"
 
@@ -50,6 +51,11 @@ namespace rl
 				
 				virtual ~Shape();
 				
+				/**
+				 * Axis-aligned bounding box in world coordinates.
+				 */
+				void getBoundingBox(::rl::math::AlignedBox3& box) const;
+				
 				void getTransform(::rl::math::Transform& transform);
 				
 				void setTransform(const ::rl::math::Transform& transform);
@@ -71,6 +77,8 @@ namespace rl
 				
 				static void triangleCallback(void* userData, ::SoCallbackAction* action, const ::SoPrimitiveVertex* v1, const SoPrimitiveVertex* v2, const ::SoPrimitiveVertex* v3);
 				
+				::rl::math::AlignedBox3 box;
+				
 				::rl::math::Transform frame;
 				
 				::rl::math::Transform transform;
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <boost/lexical_cast.hpp>
+#include <rl/sg/AabbTree.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlAabbTreeTest BOXES STEPS" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::size_t boxes = boost::lexical_cast<std::size_t>(argv[1]);
+	std::size_t steps = boost::lexical_cast<std::size_t>(argv[2]);
+	
+	std::mt19937 generator(0);
+	std::uniform_real_distribution<rl::math::Real> position(0, 10);
+	std::uniform_real_distribution<rl::math::Real> extent(0, 0.5);
+	std::uniform_real_distribution<rl::math::Real> motion(-0.25, 0.25);
+	
+	auto random = [&]() {
+		rl::math::Vector3 center(position(generator), position(generator), position(generator));
+		rl::math::Vector3 half(extent(generator), extent(generator), extent(generator));
+		return rl::math::AlignedBox3(center - half, center + half);
+	};
+	
+	rl::sg::AabbTree tree;
+	tree.setMargin(static_cast<rl::math::Real>(0.1));
+	
+	std::vector<rl::math::AlignedBox3, Eigen::aligned_allocator<rl::math::AlignedBox3>> objects(boxes);
+	std::map<std::size_t, std::size_t> leaves;
+	
+	for (std::size_t i = 0; i < boxes; ++i)
+	{
+		objects[i] = random();
+		leaves[i] = tree.insert(objects[i], &objects[i]);
+	}
+	
+	for (std::size_t i = 0; i < steps; ++i)
+	{
+		std::size_t j = generator() % boxes;
+		
+		if (0 == generator() % 3 && leaves.count(j) > 0)
+		{
+			tree.remove(leaves[j]);
+			leaves.erase(j);
+		}
+		else if (0 == leaves.count(j))
+		{
+			objects[j] = random();
+			leaves[j] = tree.insert(objects[j], &objects[j]);
+		}
+		else
+		{
+			objects[j].translate(rl::math::Vector3(motion(generator), motion(generator), motion(generator)));
+			tree.update(leaves[j], objects[j]);
+		}
+	}
+	
+	if (tree.size() != leaves.size())
+	{
+		std::cerr << "rlAabbTreeTest: size " << tree.size() << " != " << leaves.size() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::vector<std::pair<void*, void*>> pairs;
+	tree.overlap(pairs);
+	
+	std::set<std::pair<void*, void*>> found;
+	
+	for (std::size_t i = 0; i < pairs.size(); ++i)
+	{
+		found.insert(std::make_pair(std::min(pairs[i].first, pairs[i].second), std::max(pairs[i].first, pairs[i].second)));
+	}
+	
+	if (found.size() != pairs.size())
+	{
+		std::cerr << "rlAabbTreeTest: duplicate pairs" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::size_t expected = 0;
+	
+	for (std::map<std::size_t, std::size_t>::const_iterator i = leaves.begin(); i != leaves.end(); ++i)
+	{
+		if (!tree.getBox(i->second).contains(objects[i->first]))
+		{
+			std::cerr << "rlAabbTreeTest: box of leaf does not contain object" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::map<std::size_t, std::size_t>::const_iterator j = std::next(i); j != leaves.end(); ++j)
+		{
+			if (tree.getBox(i->second).intersects(tree.getBox(j->second)))
+			{
+				++expected;
+				
+				if (0 == found.count(std::make_pair(std::min<void*>(&objects[i->first], &objects[j->first]), std::max<void*>(&objects[i->first], &objects[j->first]))))
+				{
+					std::cerr << "rlAabbTreeTest: missing pair " << i->first << " " << j->first << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+	
+	if (expected != found.size())
+	{
+		std::cerr << "rlAabbTreeTest: " << found.size() << " pairs found, " << expected << " expected" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::cout << "rlAabbTreeTest: " << tree.size() << " boxes, height " << tree.getHeight() << ", " << found.size() << " pairs" << std::endl;
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/ContinuousVerifier.h>
+#include <rl/plan/RecursiveVerifier.h>
+#include <rl/plan/SequentialVerifier.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/Statistics.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+
+struct Edge
+{
+	rl::math::Real d;
+	
+	rl::math::Vector u;
+	
+	rl::math::Vector v;
+};
+
+rl::math::Real
+queriesPerEdge(rl::plan::Verifier& verifier, rl::plan::Statistics& statistics, const std::vector<Edge>& edges)
+{
+	statistics.clear();
+	
+	for (std::size_t i = 0; i < edges.size(); ++i)
+	{
+		verifier.isColliding(edges[i].u, edges[i].v, edges[i].d);
+	}
+	
+	return static_cast<rl::math::Real>(statistics.getCount(rl::plan::Statistics::PHASE_COLLISION)) / edges.size();
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlContinuousVerifierTest SCENEFILE KINEMATICSFILE" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+#ifdef RL_SG_FCL
+	try
+	{
+		rl::sg::fcl::Scene scene;
+		
+		rl::sg::XmlFactory factory;
+		factory.load(argv[1], &scene, true, false);
+		
+		std::shared_ptr<rl::kin::Kinematics> kinematics(rl::kin::Kinematics::create(argv[2]));
+		
+		rl::plan::Statistics statistics;
+		
+		rl::plan::SimpleModel model;
+		model.kin = kinematics.get();
+		model.model = scene.getModel(0);
+		model.scene = &scene;
+		model.statistics = &statistics;
+		
+		// half thickness of the plate
+		rl::plan::ContinuousVerifier continuousVerifier;
+		continuousVerifier.delta = std::numeric_limits<rl::math::Real>::infinity();
+		continuousVerifier.model = &model;
+		continuousVerifier.tolerance = static_cast<rl::math::Real>(0.01);
+		
+		rl::plan::SequentialVerifier sequentialVerifier;
+		sequentialVerifier.delta = static_cast<rl::math::Real>(0.1) * rl::math::DEG2RAD;
+		sequentialVerifier.model = &model;
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(0, 1);
+		
+		std::vector<Edge> colliding;
+		std::vector<Edge> collisionFree;
+		
+		// edges with collision free endpoints, some of them passing the plate
+		
+		for (std::size_t i = 0; i < 10000 && (colliding.size() < 10 || collisionFree.size() < 10); ++i)
+		{
+			rl::math::Vector rand(model.getDofPosition());
+			
+			for (std::ptrdiff_t j = 0; j < rand.size(); ++j)
+			{
+				rand(j) = randomDistribution(randomEngine);
+			}
+			
+			rl::math::Vector u = model.generatePositionUniform(rand);
+			rl::math::Vector v(u.size());
+			
+			for (std::ptrdiff_t j = 0; j < v.size(); ++j)
+			{
+				v(j) = u(j) + randomDistribution(randomEngine) - static_cast<rl::math::Real>(0.5);
+			}
+			
+			if (!model.isValid(v) || model.isColliding(u) || model.isColliding(v))
+			{
+				continue;
+			}
+			
+			rl::math::Real d = model.distance(u, v);
+			
+			if (!sequentialVerifier.isColliding(u, v, d))
+			{
+				if (collisionFree.size() < 10)
+				{
+					collisionFree.push_back({d, u, v});
+				}
+				
+				continue;
+			}
+			
+			if (colliding.size() >= 10)
+			{
+				continue;
+			}
+			
+			colliding.push_back({d, u, v});
+			
+			if (!continuousVerifier.isColliding(u, v, d))
+			{
+				std::cerr << "Continuous verifier misses collision between " << u.transpose() << " and " << v.transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		if (colliding.size() < 10 || collisionFree.size() < 10)
+		{
+			std::cerr << "Found only " << colliding.size() << " colliding and " << collisionFree.size() << " free edges with collision free endpoints." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		std::cout << "Continuous verifier detects collisions of " << colliding.size() << " edges." << std::endl;
+		
+		// collision queries per edge with default parameters
+		
+		rl::plan::ContinuousVerifier defaultVerifier;
+		defaultVerifier.model = &model;
+		
+		rl::plan::RecursiveVerifier recursiveVerifier;
+		recursiveVerifier.delta = 1 * rl::math::DEG2RAD;
+		recursiveVerifier.model = &model;
+		
+		rl::math::Real continuousColliding = queriesPerEdge(defaultVerifier, statistics, colliding);
+		rl::math::Real continuousFree = queriesPerEdge(defaultVerifier, statistics, collisionFree);
+		rl::math::Real recursiveColliding = queriesPerEdge(recursiveVerifier, statistics, colliding);
+		rl::math::Real recursiveFree = queriesPerEdge(recursiveVerifier, statistics, collisionFree);
+		
+		std::cout << "Queries per colliding edge: continuous " << continuousColliding << ", recursive " << recursiveColliding << std::endl;
+		std::cout << "Queries per free edge: continuous " << continuousFree << ", recursive " << recursiveFree << std::endl;
+		
+		if (continuousFree >= recursiveFree)
+		{
+			std::cerr << "Continuous verifier requires more queries per free edge than recursive verifier." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+#else // RL_SG_FCL
+	std::cerr << "Continuous verifier requires FCL." << std::endl;
+	return EXIT_FAILURE;
+#endif // RL_SG_FCL
+}
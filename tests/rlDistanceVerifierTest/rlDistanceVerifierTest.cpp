@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/DistanceModel.h>
+#include <rl/plan/DistanceVerifier.h>
+#include <rl/plan/SequentialVerifier.h>
+#include <rl/sg/Body.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 10)
+	{
+		std::cout << "Usage: rlDistanceVerifierTest ENGINE SCENEFILE KINEMATICSFILE X Y Z A B C" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory;
+		factory.load(argv[2], scene.get(), true, false);
+		
+		std::shared_ptr<rl::kin::Kinematics> kinematics(rl::kin::Kinematics::create(argv[3]));
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[7]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[4]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		
+		kinematics->world() = world;
+		
+		rl::plan::DistanceModel model;
+		model.kin = kinematics.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		rl::plan::DistanceVerifier distanceVerifier;
+		distanceVerifier.delta = static_cast<rl::math::Real>(0.01) * rl::math::DEG2RAD;
+		distanceVerifier.model = &model;
+		
+		for (std::size_t i = 0; i < model.getBodies(); ++i)
+		{
+			rl::sg::Body* body = model.getBody(i);
+			distanceVerifier.radius = std::max(distanceVerifier.radius, body->max.cwiseAbs().cwiseMax(body->min.cwiseAbs()).norm());
+		}
+		
+		rl::plan::SequentialVerifier sequentialVerifier;
+		sequentialVerifier.delta = static_cast<rl::math::Real>(0.1) * rl::math::DEG2RAD;
+		sequentialVerifier.model = &model;
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(0, 1);
+		
+		std::size_t colliding = 0;
+		std::size_t conservative = 0;
+		std::size_t free = 0;
+		
+		// edges with collision free endpoints
+		
+		for (std::size_t i = 0; i < 1000 && (colliding < 10 || free < 10); ++i)
+		{
+			rl::math::Vector rand(model.getDofPosition());
+			
+			for (std::ptrdiff_t j = 0; j < rand.size(); ++j)
+			{
+				rand(j) = randomDistribution(randomEngine);
+			}
+			
+			rl::math::Vector u = model.generatePositionUniform(rand);
+			rl::math::Vector v(u.size());
+			
+			for (std::ptrdiff_t j = 0; j < v.size(); ++j)
+			{
+				v(j) = u(j) + randomDistribution(randomEngine) - static_cast<rl::math::Real>(0.5);
+			}
+			
+			if (!model.isValid(v) || model.isColliding(u) || model.isColliding(v))
+			{
+				continue;
+			}
+			
+			rl::math::Real d = model.distance(u, v);
+			bool expected = sequentialVerifier.isColliding(u, v, d);
+			
+			bool result = distanceVerifier.isColliding(u, v, d);
+			
+			// collisions found by the sequential verifier must not be missed
+			
+			if (expected && !result)
+			{
+				std::cerr << "Distance verifier misses collision found by sequential verifier between " << u.transpose() << " and " << v.transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			if (expected)
+			{
+				++colliding;
+			}
+			else
+			{
+				++free;
+				
+				if (result)
+				{
+					++conservative;
+				}
+			}
+		}
+		
+		std::cout << "Colliding edges: " << colliding << ", free edges: " << free << " (" << conservative << " reported colliding)" << std::endl;
+		
+		if (colliding < 10 || free < 10)
+		{
+			std::cerr << "Found too few colliding or free edges." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/Workspace.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlDynamicsBenchmark MODELFILE SAMPLES" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		std::size_t samples = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::srand(0); // get reproducible results
+		
+		rl::math::Matrix q = rl::math::Matrix::Random(dynamic->getDofPosition(), samples);
+		rl::math::Matrix qd = rl::math::Matrix::Random(dynamic->getDof(), samples);
+		rl::math::Matrix qdd = rl::math::Matrix::Random(dynamic->getDof(), samples);
+		
+		rl::math::Matrix tauSingle(dynamic->getDof(), samples);
+		rl::math::Matrix qddSingle(dynamic->getDof(), samples);
+		rl::math::Matrix tauBatch(dynamic->getDof(), samples);
+		rl::math::Matrix qddBatch(dynamic->getDof(), samples);
+		
+		// one state at a time
+		
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < samples; ++i)
+		{
+			dynamic->setPosition(q.col(i));
+			dynamic->setVelocity(qd.col(i));
+			dynamic->setAcceleration(qdd.col(i));
+			dynamic->inverseDynamics();
+			tauSingle.col(i) = dynamic->getTorque();
+		}
+		
+		std::chrono::steady_clock::duration inverseSingle = std::chrono::steady_clock::now() - start;
+		
+		start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < samples; ++i)
+		{
+			dynamic->setPosition(q.col(i));
+			dynamic->setVelocity(qd.col(i));
+			dynamic->setTorque(tauSingle.col(i));
+			dynamic->forwardDynamics();
+			qddSingle.col(i) = dynamic->getAcceleration();
+		}
+		
+		std::chrono::steady_clock::duration forwardSingle = std::chrono::steady_clock::now() - start;
+		
+		// batch of states
+		
+		rl::mdl::Workspace workspace(dynamic.get());
+		
+		start = std::chrono::steady_clock::now();
+		dynamic->inverseDynamics(workspace, q, qd, qdd, tauBatch);
+		std::chrono::steady_clock::duration inverseBatch = std::chrono::steady_clock::now() - start;
+		
+		start = std::chrono::steady_clock::now();
+		dynamic->forwardDynamics(workspace, q, qd, tauBatch, qddBatch);
+		std::chrono::steady_clock::duration forwardBatch = std::chrono::steady_clock::now() - start;
+		
+		if (!tauBatch.isApprox(tauSingle) || !qddBatch.isApprox(qddSingle) || !qddBatch.isApprox(qdd))
+		{
+			std::cerr << "tau (single) = " << std::endl << tauSingle << std::endl;
+			std::cerr << "tau (batch) = " << std::endl << tauBatch << std::endl;
+			std::cerr << "qdd (single) = " << std::endl << qddSingle << std::endl;
+			std::cerr << "qdd (batch) = " << std::endl << qddBatch << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		std::cout << "inverse dynamics (single): " << samples / std::chrono::duration_cast<std::chrono::duration<double>>(inverseSingle).count() << " samples/s" << std::endl;
+		std::cout << "inverse dynamics (batch): " << samples / std::chrono::duration_cast<std::chrono::duration<double>>(inverseBatch).count() << " samples/s" << std::endl;
+		std::cout << "forward dynamics (single): " << samples / std::chrono::duration_cast<std::chrono::duration<double>>(forwardSingle).count() << " samples/s" << std::endl;
+		std::cout << "forward dynamics (batch): " << samples / std::chrono::duration_cast<std::chrono::duration<double>>(forwardBatch).count() << " samples/s" << std::endl;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/Workspace.h>
+#include <rl/mdl/XmlFactory.h>
+
+void
+evaluate(const rl::mdl::Dynamic& dynamic, rl::mdl::Workspace& workspace, const rl::math::Vector& q, const rl::math::Vector& qd, const rl::math::Vector& qdd, const rl::math::Vector& tau, rl::math::Vector& tauOut, rl::math::Vector& qddOut)
+{
+	workspace.q = q;
+	workspace.qd = qd;
+	workspace.qdd = qdd;
+	dynamic.forwardPosition(workspace);
+	dynamic.inverseDynamics(workspace);
+	tauOut = workspace.tau;
+	
+	workspace.tau = tau;
+	dynamic.forwardDynamics(workspace);
+	qddOut = workspace.qdd;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlDynamicsDerivativesTest MODELFILE LOOP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::srand(std::random_device()());
+		
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		rl::mdl::Workspace workspace(dynamic.get());
+		
+		rl::math::Real h = static_cast<rl::math::Real>(1.0e-6);
+		
+		rl::math::Vector maximum = dynamic->getMaximum().cwiseMin(static_cast<rl::math::Real>(3));
+		rl::math::Vector minimum = dynamic->getMinimum().cwiseMax(static_cast<rl::math::Real>(-3));
+		
+		for (std::size_t n = 0; n < boost::lexical_cast<std::size_t>(argv[2]); ++n)
+		{
+			// stay clear of joint limits, as steps are clamped
+			rl::math::Vector rand = (rl::math::Vector::Random(dynamic->getDof()).array() + 1) * static_cast<rl::math::Real>(0.4) + static_cast<rl::math::Real>(0.1);
+			rl::math::Vector q = dynamic->generatePositionUniform(rand, minimum, maximum);
+			rl::math::Vector qd = rl::math::Vector::Random(dynamic->getDof());
+			rl::math::Vector qdd = rl::math::Vector::Random(dynamic->getDof());
+			rl::math::Vector tau = rl::math::Vector::Random(dynamic->getDof());
+			
+			// analytical derivatives
+			
+			rl::math::Matrix dtaudq;
+			rl::math::Matrix dtaudqd;
+			
+			workspace.q = q;
+			workspace.qd = qd;
+			workspace.qdd = qdd;
+			dynamic->forwardPosition(workspace);
+			dynamic->calculateInverseDynamicsDerivatives(workspace, dtaudq, dtaudqd);
+			
+			rl::math::Matrix dqdddq;
+			rl::math::Matrix dqdddqd;
+			rl::math::Matrix dqdddtau;
+			
+			workspace.tau = tau;
+			dynamic->calculateForwardDynamicsDerivatives(workspace, dqdddq, dqdddqd, dqdddtau);
+			
+			// central finite differences
+			
+			rl::math::Matrix dtaudqNumerical(dynamic->getDof(), dynamic->getDof());
+			rl::math::Matrix dtaudqdNumerical(dynamic->getDof(), dynamic->getDof());
+			rl::math::Matrix dqdddqNumerical(dynamic->getDof(), dynamic->getDof());
+			rl::math::Matrix dqdddqdNumerical(dynamic->getDof(), dynamic->getDof());
+			rl::math::Matrix dqdddtauNumerical(dynamic->getDof(), dynamic->getDof());
+			
+			for (std::size_t i = 0; i < dynamic->getDof(); ++i)
+			{
+				rl::math::Vector dq = rl::math::Vector::Unit(dynamic->getDof(), i) * h;
+				rl::math::Vector qPlus(dynamic->getDofPosition());
+				rl::math::Vector qMinus(dynamic->getDofPosition());
+				dynamic->step(q, dq, qPlus);
+				dynamic->step(q, -dq, qMinus);
+				
+				rl::math::Vector tauPlus(dynamic->getDof());
+				rl::math::Vector tauMinus(dynamic->getDof());
+				rl::math::Vector qddPlus(dynamic->getDof());
+				rl::math::Vector qddMinus(dynamic->getDof());
+				
+				evaluate(*dynamic, workspace, qPlus, qd, qdd, tau, tauPlus, qddPlus);
+				evaluate(*dynamic, workspace, qMinus, qd, qdd, tau, tauMinus, qddMinus);
+				dtaudqNumerical.col(i) = (tauPlus - tauMinus) / (2 * h);
+				dqdddqNumerical.col(i) = (qddPlus - qddMinus) / (2 * h);
+				
+				evaluate(*dynamic, workspace, q, qd + dq, qdd, tau, tauPlus, qddPlus);
+				evaluate(*dynamic, workspace, q, qd - dq, qdd, tau, tauMinus, qddMinus);
+				dtaudqdNumerical.col(i) = (tauPlus - tauMinus) / (2 * h);
+				dqdddqdNumerical.col(i) = (qddPlus - qddMinus) / (2 * h);
+				
+				evaluate(*dynamic, workspace, q, qd, qdd, tau + dq, tauPlus, qddPlus);
+				evaluate(*dynamic, workspace, q, qd, qdd, tau - dq, tauMinus, qddMinus);
+				dqdddtauNumerical.col(i) = (qddPlus - qddMinus) / (2 * h);
+			}
+			
+			if (
+				!dtaudq.isApprox(dtaudqNumerical, static_cast<rl::math::Real>(1.0e-5)) ||
+				!dtaudqd.isApprox(dtaudqdNumerical, static_cast<rl::math::Real>(1.0e-5)) ||
+				!dqdddq.isApprox(dqdddqNumerical, static_cast<rl::math::Real>(1.0e-5)) ||
+				!dqdddqd.isApprox(dqdddqdNumerical, static_cast<rl::math::Real>(1.0e-5)) ||
+				!dqdddtau.isApprox(dqdddtauNumerical, static_cast<rl::math::Real>(1.0e-5))
+			)
+			{
+				std::cerr << "q = " << q.transpose() << std::endl;
+				std::cerr << "qd = " << qd.transpose() << std::endl;
+				std::cerr << "qdd = " << qdd.transpose() << std::endl;
+				std::cerr << "tau = " << tau.transpose() << std::endl;
+				std::cerr << "dtau/dq (analytical) = " << std::endl << dtaudq << std::endl;
+				std::cerr << "dtau/dq (numerical) = " << std::endl << dtaudqNumerical << std::endl;
+				std::cerr << "dtau/dqd (analytical) = " << std::endl << dtaudqd << std::endl;
+				std::cerr << "dtau/dqd (numerical) = " << std::endl << dtaudqdNumerical << std::endl;
+				std::cerr << "dqdd/dq (analytical) = " << std::endl << dqdddq << std::endl;
+				std::cerr << "dqdd/dq (numerical) = " << std::endl << dqdddqNumerical << std::endl;
+				std::cerr << "dqdd/dqd (analytical) = " << std::endl << dqdddqd << std::endl;
+				std::cerr << "dqdd/dqd (numerical) = " << std::endl << dqdddqdNumerical << std::endl;
+				std::cerr << "dqdd/dtau (analytical) = " << std::endl << dqdddtau << std::endl;
+				std::cerr << "dqdd/dtau (numerical) = " << std::endl << dqdddtauNumerical << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
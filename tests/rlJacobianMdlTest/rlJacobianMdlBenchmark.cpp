@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlJacobianMdlBenchmark KINEMATICFILE LOOP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory.create(argv[1]));
+		
+		std::size_t loop = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::srand(0); // get reproducible results
+		
+		rl::math::Matrix q = rl::math::Matrix::Random(kinematic->getDofPosition(), loop);
+		rl::math::Matrix qd = rl::math::Matrix::Random(kinematic->getDof(), loop);
+		
+		rl::math::Matrix jacobianColumns(6 * kinematic->getOperationalDof(), kinematic->getDof());
+		rl::math::Vector jacobianDerivativeColumns(6 * kinematic->getOperationalDof());
+		rl::math::Matrix jacobianAnalytical(6 * kinematic->getOperationalDof(), kinematic->getDof());
+		rl::math::Vector jacobianDerivativeAnalytical(6 * kinematic->getOperationalDof());
+		
+		std::chrono::steady_clock::duration durationColumns = std::chrono::steady_clock::duration::zero();
+		std::chrono::steady_clock::duration durationAnalytical = std::chrono::steady_clock::duration::zero();
+		
+		for (std::size_t n = 0; n < loop; ++n)
+		{
+			// one forward velocity pass per column
+			
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			
+			kinematic->setPosition(q.col(n));
+			kinematic->forwardPosition();
+			
+			for (std::size_t i = 0; i < kinematic->getDof(); ++i)
+			{
+				kinematic->setVelocity(rl::math::Vector::Unit(kinematic->getDof(), i));
+				kinematic->forwardVelocity();
+				
+				for (std::size_t j = 0; j < kinematic->getOperationalDof(); ++j)
+				{
+					jacobianColumns.block(j * 6, i, 3, 1) = kinematic->getOperationalPosition(j).linear() * kinematic->getOperationalVelocity(j).linear();
+					jacobianColumns.block(j * 6 + 3, i, 3, 1) = kinematic->getOperationalPosition(j).linear() * kinematic->getOperationalVelocity(j).angular();
+				}
+			}
+			
+			kinematic->setVelocity(qd.col(n));
+			kinematic->setAcceleration(rl::math::Vector::Zero(kinematic->getDof()));
+			kinematic->forwardVelocity();
+			kinematic->forwardAcceleration();
+			
+			for (std::size_t j = 0; j < kinematic->getOperationalDof(); ++j)
+			{
+				rl::math::Matrix33 wR = kinematic->getOperationalVelocity(j).angular().cross33() * kinematic->getOperationalPosition(j).linear();
+				jacobianDerivativeColumns.segment(j * 6, 3) = kinematic->getOperationalPosition(j).linear() * kinematic->getOperationalAcceleration(j).linear() + wR * kinematic->getOperationalVelocity(j).linear();
+				jacobianDerivativeColumns.segment(j * 6 + 3, 3) = kinematic->getOperationalPosition(j).linear() * kinematic->getOperationalAcceleration(j).angular() + wR * kinematic->getOperationalVelocity(j).angular();
+			}
+			
+			durationColumns += std::chrono::steady_clock::now() - start;
+			
+			// single pass over motion subspaces
+			
+			start = std::chrono::steady_clock::now();
+			
+			kinematic->setPosition(q.col(n));
+			kinematic->setVelocity(qd.col(n));
+			kinematic->calculateJacobian(jacobianAnalytical);
+			kinematic->calculateJacobianDerivative(jacobianDerivativeAnalytical);
+			
+			durationAnalytical += std::chrono::steady_clock::now() - start;
+			
+			if (!jacobianAnalytical.isApprox(jacobianColumns) || !jacobianDerivativeAnalytical.isApprox(jacobianDerivativeColumns))
+			{
+				std::cerr << "q = " << q.col(n).transpose() << std::endl;
+				std::cerr << "qd = " << qd.col(n).transpose() << std::endl;
+				std::cerr << "J (columns) = " << std::endl << jacobianColumns << std::endl;
+				std::cerr << "J (analytical) = " << std::endl << jacobianAnalytical << std::endl;
+				std::cerr << "Jdqd (columns) = " << jacobianDerivativeColumns.transpose() << std::endl;
+				std::cerr << "Jdqd (analytical) = " << jacobianDerivativeAnalytical.transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		std::cout << "columns: " << std::chrono::duration_cast<std::chrono::duration<double>>(durationColumns).count() * 1000 * 1000 / loop << " us" << std::endl;
+		std::cout << "analytical: " << std::chrono::duration_cast<std::chrono::duration<double>>(durationAnalytical).count() * 1000 * 1000 / loop << " us" << std::endl;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
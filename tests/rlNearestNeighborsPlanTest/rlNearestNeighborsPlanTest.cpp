@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <rl/kin/Kinematics.h>
+#include <rl/plan/GnatNearestNeighbors.h>
+#include <rl/plan/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/plan/KdtreeNearestNeighbors.h>
+#include <rl/plan/LinearNearestNeighbors.h>
+#include <rl/plan/Model.h>
+#include <rl/plan/VectorizedLinearNearestNeighbors.h>
+
+bool
+isEqual(const std::vector<rl::plan::NearestNeighbors::Neighbor>& expected, const std::vector<rl::plan::NearestNeighbors::Neighbor>& neighbors, const std::size_t& begin, const std::size_t& end)
+{
+	if (expected.size() != end - begin)
+	{
+		return false;
+	}
+	
+	for (std::size_t i = 0; i < expected.size(); ++i)
+	{
+		if (expected[i].first != neighbors[begin + i].first || expected[i].second.first != neighbors[begin + i].second.first)
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+bool
+test(rl::plan::Model* model, rl::plan::NearestNeighbors* nearestNeighbors, const std::string& name, const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Vector>& queries)
+{
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		nearestNeighbors->push(rl::plan::NearestNeighbors::Value(&points[i], nullptr));
+	}
+	
+	std::vector<rl::plan::NearestNeighbors::Value> values;
+	
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+		values.push_back(rl::plan::NearestNeighbors::Value(&queries[i], nullptr));
+	}
+	
+	rl::plan::NearestNeighbors::Distance radius = nearestNeighbors->isTransformedDistance() ? model->transformedDistance(1) : 1;
+	
+	std::vector<rl::plan::NearestNeighbors::Neighbor> neighbors;
+	std::vector<std::size_t> offsets;
+	
+	for (std::size_t threads = 1; threads <= 4; ++threads)
+	{
+		nearestNeighbors->setNumThreads(threads);
+		
+		for (std::size_t k = 1; k <= 20; k += 19)
+		{
+			nearestNeighbors->nearest(values, k, neighbors, offsets);
+			
+			if (offsets.size() != values.size() + 1 || neighbors.size() != offsets.back())
+			{
+				std::cerr << name << ": Invalid offsets of nearest() with " << threads << " threads" << std::endl;
+				return false;
+			}
+			
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if (!isEqual(nearestNeighbors->nearest(values[i], k), neighbors, offsets[i], offsets[i + 1]))
+				{
+					std::cerr << name << ": Batch nearest() with " << threads << " threads and k = " << k << " differs from single query " << i << std::endl;
+					return false;
+				}
+			}
+		}
+		
+		nearestNeighbors->radius(values, radius, neighbors, offsets);
+		
+		if (offsets.size() != values.size() + 1 || neighbors.size() != offsets.back())
+		{
+			std::cerr << name << ": Invalid offsets of radius() with " << threads << " threads" << std::endl;
+			return false;
+		}
+		
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (!isEqual(nearestNeighbors->radius(values[i], radius), neighbors, offsets[i], offsets[i + 1]))
+			{
+				std::cerr << name << ": Batch radius() with " << threads << " threads differs from single query " << i << std::endl;
+				return false;
+			}
+		}
+	}
+	
+	std::cout << name << ": Batch queries match single queries" << std::endl;
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: rlNearestNeighborsPlanTest KINEMATICSFILE" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::kin::Kinematics> kinematics(rl::kin::Kinematics::create(argv[1]));
+		
+		rl::plan::Model model;
+		model.kin = kinematics.get();
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(0, 1);
+		
+		std::vector<rl::math::Vector> points(2000);
+		
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			rl::math::Vector rand(model.getDofPosition());
+			
+			for (std::ptrdiff_t j = 0; j < rand.size(); ++j)
+			{
+				rand(j) = randomDistribution(randomEngine);
+			}
+			
+			points[i] = model.generatePositionUniform(rand);
+		}
+		
+		std::vector<rl::math::Vector> queries(101);
+		
+		for (std::size_t i = 0; i < queries.size(); ++i)
+		{
+			rl::math::Vector rand(model.getDofPosition());
+			
+			for (std::ptrdiff_t j = 0; j < rand.size(); ++j)
+			{
+				rand(j) = randomDistribution(randomEngine);
+			}
+			
+			queries[i] = model.generatePositionUniform(rand);
+		}
+		
+		rl::plan::GnatNearestNeighbors gnat(&model);
+		rl::plan::KdtreeBoundingBoxNearestNeighbors kdtreeBoundingBox(&model);
+		rl::plan::KdtreeNearestNeighbors kdtree(&model);
+		rl::plan::LinearNearestNeighbors linear(&model);
+		rl::plan::VectorizedLinearNearestNeighbors vectorizedLinear(&model);
+		
+		if (!test(&model, &gnat, "GnatNearestNeighbors", points, queries) ||
+			!test(&model, &kdtreeBoundingBox, "KdtreeBoundingBoxNearestNeighbors", points, queries) ||
+			!test(&model, &kdtree, "KdtreeNearestNeighbors", points, queries) ||
+			!test(&model, &linear, "LinearNearestNeighbors", points, queries) ||
+			!test(&model, &vectorizedLinear, "VectorizedLinearNearestNeighbors", points, queries))
+		{
+			return EXIT_FAILURE;
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
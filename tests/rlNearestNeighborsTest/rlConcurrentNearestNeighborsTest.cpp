@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/math/ConcurrentNearestNeighbors.h>
+#include <rl/math/GnatNearestNeighbors.h>
+#include <rl/math/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/math/KdtreeNearestNeighbors.h>
+#include <rl/math/LinearNearestNeighbors.h>
+#include <rl/math/Vector.h>
+#include <rl/math/metrics/L2.h>
+#include <rl/math/metrics/L2Squared.h>
+
+#include "iterator.h"
+
+template<typename NearestNeighbors>
+void
+stress(const std::string& name, const std::vector<rl::math::Vector>& points, const std::size_t& threads, const std::size_t& dim)
+{
+	typedef typename NearestNeighbors::Metric Metric;
+	
+	rl::math::ConcurrentNearestNeighbors<NearestNeighbors> nearestNeighbors;
+	nearestNeighbors.setRebuildThreshold(128);
+	
+	std::unique_ptr<std::atomic<bool>[]> pushed(new std::atomic<bool>[points.size()]);
+	
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		pushed[i].store(false);
+	}
+	
+	std::atomic<std::size_t> errors(0);
+	std::atomic<std::size_t> queries(0);
+	
+	auto worker = [&](const std::size_t& thread)
+	{
+		std::mt19937 randomEngine(thread);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(-1, 1);
+		Metric metric;
+		
+		for (std::size_t i = thread; i < points.size(); i += threads)
+		{
+			nearestNeighbors.push(&points[i]);
+			pushed[i].store(true, std::memory_order_release);
+			
+			if (0 != i % 50)
+			{
+				continue;
+			}
+			
+			rl::math::Vector query(dim);
+			
+			for (std::size_t j = 0; j < dim; ++j)
+			{
+				query(j) = randomDistribution(randomEngine);
+			}
+			
+			// all values pushed before the query starts have to be considered
+			typename NearestNeighbors::Distance minimum = std::numeric_limits<typename NearestNeighbors::Distance>::infinity();
+			
+			for (std::size_t j = 0; j < points.size(); ++j)
+			{
+				if (pushed[j].load(std::memory_order_acquire))
+				{
+					minimum = std::min(minimum, metric(&query, &points[j]));
+				}
+			}
+			
+			std::vector<typename NearestNeighbors::Neighbor> neighbors = nearestNeighbors.nearest(&query, 1);
+			
+			if (1 != neighbors.size() || neighbors.front().first > minimum || static_cast<std::size_t>(neighbors.front().second - points.data()) >= points.size())
+			{
+				++errors;
+			}
+			
+			++queries;
+		}
+	};
+	
+	std::vector<std::thread> workers;
+	
+	for (std::size_t i = 0; i < threads; ++i)
+	{
+		workers.emplace_back(worker, i);
+	}
+	
+	for (std::size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+	
+	std::cout << name << ": " << threads << " threads, " << nearestNeighbors.size() << " values, " << queries << " queries, " << errors << " errors" << std::endl;
+	
+	if (errors > 0 || points.size() != nearestNeighbors.size())
+	{
+		std::cerr << name << ": Concurrent queries failed" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+	
+	std::vector<const rl::math::Vector*> values(points.size());
+	
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		values[i] = &points[i];
+	}
+	
+	rl::math::LinearNearestNeighbors<Metric> linear(values.begin(), values.end());
+	
+	for (std::size_t i = 0; i < 100; ++i)
+	{
+		rl::math::Vector query = rl::math::Vector::Random(dim);
+		std::vector<typename NearestNeighbors::Neighbor> expected = linear.nearest(&query, 10);
+		std::vector<typename NearestNeighbors::Neighbor> neighbors = nearestNeighbors.nearest(&query, 10);
+		std::vector<typename NearestNeighbors::Neighbor> radius = nearestNeighbors.radius(&query, expected.back().first);
+		
+		if (expected.size() != neighbors.size() || radius.size() != expected.size() - 1)
+		{
+			std::cerr << name << ": Found " << neighbors.size() << " nearest and " << radius.size() << " radius neighbors" << std::endl;
+			exit(EXIT_FAILURE);
+		}
+		
+		for (std::size_t j = 0; j < expected.size(); ++j)
+		{
+			if (expected[j].first != neighbors[j].first || (j < radius.size() && expected[j].first != radius[j].first))
+			{
+				std::cerr << name << ": Neighbor " << j << " differs from LinearNearestNeighbors" << std::endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 4)
+	{
+		std::cout << "Usage: rlConcurrentNearestNeighborsTest THREADS POINTS DIM" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::size_t threads = boost::lexical_cast<std::size_t>(argv[1]);
+	std::size_t n = boost::lexical_cast<std::size_t>(argv[2]);
+	std::size_t dim = boost::lexical_cast<std::size_t>(argv[3]);
+	
+	std::vector<rl::math::Vector> points;
+	points.reserve(n);
+	
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		points.push_back(rl::math::Vector::Random(dim));
+	}
+	
+	typedef rl::math::metrics::L2<const rl::math::Vector*> Metric;
+	typedef rl::math::metrics::L2Squared<const rl::math::Vector*> MetricSquared;
+	
+	stress<rl::math::GnatNearestNeighbors<Metric>>("GnatNearestNeighbors<Metric>", points, threads, dim);
+	stress<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>>("KdtreeBoundingBoxNearestNeighbors<MetricSquared>", points, threads, dim);
+	stress<rl::math::KdtreeNearestNeighbors<MetricSquared>>("KdtreeNearestNeighbors<MetricSquared>", points, threads, dim);
+	stress<rl::math::LinearNearestNeighbors<MetricSquared>>("LinearNearestNeighbors<MetricSquared>", points, threads, dim);
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <boost/optional.hpp>
+#include <rl/math/KdtreeNearestNeighbors.h>
+#include <rl/math/Vector.h>
+#include <rl/math/metrics/L2Squared.h>
+
+#include "iterator.h"
+
+typedef rl::math::KdtreeNearestNeighbors<rl::math::metrics::L2Squared<const rl::math::Vector*>> NearestNeighbors;
+
+void
+benchmark(const std::string& name, const boost::optional<double>& balance, const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Vector>& queries)
+{
+	NearestNeighbors nearestNeighbors;
+	nearestNeighbors.setBalance(balance);
+	
+	std::cout << name << std::endl;
+	
+	double push = 0;
+	
+	for (std::size_t i = 0, next = 1000; i < points.size(); ++i)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		nearestNeighbors.push(&points[i]);
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		
+		push += std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000;
+		
+		if (i + 1 == next || i + 1 == points.size())
+		{
+			std::size_t found = 0;
+			
+			start = std::chrono::steady_clock::now();
+			
+			for (std::size_t j = 0; j < queries.size(); ++j)
+			{
+				found += nearestNeighbors.nearest(&queries[j], 1).size();
+			}
+			
+			stop = std::chrono::steady_clock::now();
+			
+			double nearest = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000 * 1000 / queries.size();
+			
+			std::cout << "  " << i + 1 << " values, depth " << nearestNeighbors.depth() << ", push " << push << " ms, nearest " << nearest << " us" << std::endl;
+			
+			if (found != queries.size())
+			{
+				std::cerr << name << ": Found " << found << " neighbors" << std::endl;
+				exit(EXIT_FAILURE);
+			}
+			
+			next *= 10;
+		}
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 5)
+	{
+		std::cout << "Usage: rlKdtreeNearestNeighborsBenchmark POINTS DIM QUERIES STEP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::size_t n = boost::lexical_cast<std::size_t>(argv[1]);
+	std::size_t dim = boost::lexical_cast<std::size_t>(argv[2]);
+	rl::math::Real step = boost::lexical_cast<rl::math::Real>(argv[4]);
+	
+	std::mt19937 randomEngine(0);
+	std::uniform_real_distribution<rl::math::Real> randomDistribution(-1, 1);
+	
+	// straight segments of 100 steps in random directions, similar to extensions of a growing tree
+	std::vector<rl::math::Vector> points;
+	points.reserve(n);
+	points.push_back(rl::math::Vector::Zero(dim));
+	
+	rl::math::Vector direction(dim);
+	
+	for (std::size_t i = 1; i < n; ++i)
+	{
+		if (1 == i % 100)
+		{
+			for (std::size_t j = 0; j < dim; ++j)
+			{
+				direction(j) = randomDistribution(randomEngine);
+			}
+			
+			direction.normalize();
+		}
+		
+		rl::math::Vector point = points.back() + step * direction;
+		
+		for (std::size_t j = 0; j < dim; ++j)
+		{
+			if (std::abs(point(j)) > 1)
+			{
+				direction(j) = -direction(j);
+				point(j) = std::max<rl::math::Real>(-1, std::min<rl::math::Real>(1, point(j)));
+			}
+		}
+		
+		points.push_back(point);
+	}
+	
+	// uniform queries, similar to the samples extending a tree
+	std::vector<rl::math::Vector> queries;
+	
+	for (std::size_t i = 0; i < boost::lexical_cast<std::size_t>(argv[3]); ++i)
+	{
+		queries.push_back(rl::math::Vector(dim));
+		
+		for (std::size_t j = 0; j < dim; ++j)
+		{
+			queries.back()(j) = randomDistribution(randomEngine);
+		}
+	}
+	
+	benchmark("KdtreeNearestNeighbors (unbalanced)", boost::none, points, queries);
+	benchmark("KdtreeNearestNeighbors (balance 0.75)", 0.75, points, queries);
+	
+	return EXIT_SUCCESS;
+}
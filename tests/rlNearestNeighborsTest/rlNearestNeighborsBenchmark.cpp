@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/math/GnatNearestNeighbors.h>
+#include <rl/math/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/math/KdtreeNearestNeighbors.h>
+#include <rl/math/LinearNearestNeighbors.h>
+#include <rl/math/Vector.h>
+#include <rl/math/VectorizedLinearNearestNeighbors.h>
+#include <rl/math/metrics/L2.h>
+#include <rl/math/metrics/L2Squared.h>
+
+#include "iterator.h"
+
+template<typename NearestNeighbors>
+void
+benchmark(const std::string& name, const std::vector<const rl::math::Vector*>& points, const std::vector<rl::math::Vector>& queries, const std::size_t& k)
+{
+	NearestNeighbors nearestNeighbors;
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		nearestNeighbors.push(points[i]);
+	}
+	
+	std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+	
+	double push = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000;
+	
+	NearestNeighbors nearestNeighbors2;
+	std::vector<const rl::math::Vector*> values(points);
+	
+	start = std::chrono::steady_clock::now();
+	nearestNeighbors2.insert(values.begin(), values.end());
+	stop = std::chrono::steady_clock::now();
+	
+	double insert = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000;
+	
+	std::size_t found = 0;
+	
+	start = std::chrono::steady_clock::now();
+	
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+		found += nearestNeighbors.nearest(&queries[i], k).size();
+	}
+	
+	stop = std::chrono::steady_clock::now();
+	
+	double nearest = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000 * 1000 / queries.size();
+	
+	start = std::chrono::steady_clock::now();
+	
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+		found += nearestNeighbors2.nearest(&queries[i], k).size();
+	}
+	
+	stop = std::chrono::steady_clock::now();
+	
+	double nearest2 = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000 * 1000 / queries.size();
+	
+	std::cout << name << std::endl;
+	std::cout << "  push " << push << " ms, nearest " << nearest << " us" << std::endl;
+	std::cout << "  insert " << insert << " ms, nearest " << nearest2 << " us" << std::endl;
+	
+	if (found != 2 * queries.size() * std::min(k, points.size()))
+	{
+		std::cerr << name << ": Found " << found << " neighbors" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 5)
+	{
+		std::cout << "Usage: rlNearestNeighborsBenchmark POINTS DIM QUERIES K" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	std::size_t n = boost::lexical_cast<std::size_t>(argv[1]);
+	std::size_t dim = boost::lexical_cast<std::size_t>(argv[2]);
+	std::size_t k = boost::lexical_cast<std::size_t>(argv[4]);
+	
+	std::vector<rl::math::Vector> points;
+	points.reserve(n);
+	
+	std::vector<const rl::math::Vector*> points2;
+	points2.reserve(n);
+	
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		points.push_back(rl::math::Vector::Random(dim));
+		points2.push_back(&points.back());
+	}
+	
+	std::vector<rl::math::Vector> queries;
+	
+	for (std::size_t i = 0; i < boost::lexical_cast<std::size_t>(argv[3]); ++i)
+	{
+		queries.push_back(rl::math::Vector::Random(dim));
+	}
+	
+	typedef rl::math::metrics::L2<const rl::math::Vector*> Metric;
+	typedef rl::math::metrics::L2Squared<const rl::math::Vector*> MetricSquared;
+	
+	benchmark<rl::math::LinearNearestNeighbors<MetricSquared>>("LinearNearestNeighbors<MetricSquared>", points2, queries, k);
+	benchmark<rl::math::GnatNearestNeighbors<Metric>>("GnatNearestNeighbors<Metric>", points2, queries, k);
+	benchmark<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>>("KdtreeBoundingBoxNearestNeighbors<MetricSquared>", points2, queries, k);
+	benchmark<rl::math::KdtreeNearestNeighbors<MetricSquared>>("KdtreeNearestNeighbors<MetricSquared>", points2, queries, k);
+	benchmark<rl::math::VectorizedLinearNearestNeighbors<const rl::math::Vector*>>("VectorizedLinearNearestNeighbors", points2, queries, k);
+	
+	return EXIT_SUCCESS;
+}
@@ -6,6 +6,7 @@
 #include <rl/math/KdtreeNearestNeighbors.h>
 #include <rl/math/LinearNearestNeighbors.h>
 #include <rl/math/Vector.h>
+#include <rl/math/VectorizedLinearNearestNeighbors.h>
 #include <rl/math/metrics/L2.h>
 #include <rl/math/metrics/L2Squared.h>
 
@@ -106,6 +107,9 @@ test(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Ve
 	std::cout << "** KdtreeNearestNeighbors<MetricSquared> **************************************" << std::endl;
 	std::vector<std::vector<rl::math::KdtreeNearestNeighbors<MetricSquared>::Neighbor>> kdtree = test<rl::math::KdtreeNearestNeighbors<MetricSquared>>(points, queries, iterative, true);
 	
+	std::cout << "** VectorizedLinearNearestNeighbors *******************************************" << std::endl;
+	std::vector<std::vector<rl::math::VectorizedLinearNearestNeighbors<const rl::math::Vector*>::Neighbor>> vectorizedLinear = test<rl::math::VectorizedLinearNearestNeighbors<const rl::math::Vector*>>(points, queries, iterative, true);
+	
 	for (std::size_t i = 0; i < linear.size(); ++i)
 	{
 		for (std::size_t j = 0; j < linear[i].size(); ++j)
@@ -145,6 +149,15 @@ test(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Ve
 				std::cerr << "[" << i << "][" << j << "] " << std::sqrt(kdtree[i][j].first) << " KdtreeNearestNeighbors<MetricSquared>: " << kdtree[i][j].second->transpose() << std::endl;
 				exit(EXIT_FAILURE);
 			}
+			
+			if (!Eigen::internal::isApprox(linear[i][j].first, std::sqrt(vectorizedLinear[i][j].first)) ||
+				!linear[i][j].second->isApprox(*vectorizedLinear[i][j].second))
+			{
+				std::cerr << "rlNearestNeighborsTest: LinearNearestNeighbors<Metric> != VectorizedLinearNearestNeighbors" << std::endl;
+				std::cerr << "[" << i << "][" << j << "] " << linear[i][j].first << " LinearNearestNeighbors<Metric>: " << linear[i][j].second->transpose() << std::endl;
+				std::cerr << "[" << i << "][" << j << "] " << std::sqrt(vectorizedLinear[i][j].first) << " VectorizedLinearNearestNeighbors: " << vectorizedLinear[i][j].second->transpose() << std::endl;
+				exit(EXIT_FAILURE);
+			}
 		}
 	}
 }
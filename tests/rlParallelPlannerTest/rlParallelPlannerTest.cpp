@@ -0,0 +1,242 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/KdtreeNearestNeighbors.h>
+#include <rl/plan/ParallelPlanner.h>
+#include <rl/plan/RrtConCon.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+struct Worker
+{
+	std::shared_ptr<rl::kin::Kinematics> kinematics;
+	
+	std::shared_ptr<rl::plan::SimpleModel> model;
+	
+	std::vector<std::shared_ptr<rl::plan::KdtreeNearestNeighbors>> nearestNeighbors;
+	
+	std::shared_ptr<rl::plan::RrtConCon> planner;
+	
+	std::shared_ptr<rl::plan::UniformSampler> sampler;
+	
+	std::shared_ptr<rl::sg::Scene> scene;
+};
+
+std::shared_ptr<rl::sg::Scene>
+createScene(const std::string& engine)
+{
+#ifdef RL_SG_BULLET
+	if ("bullet" == engine)
+	{
+		return std::make_shared<rl::sg::bullet::Scene>();
+	}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+	if ("fcl" == engine)
+	{
+		return std::make_shared<rl::sg::fcl::Scene>();
+	}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+	if ("ode" == engine)
+	{
+		return std::make_shared<rl::sg::ode::Scene>();
+	}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	if ("pqp" == engine)
+	{
+		return std::make_shared<rl::sg::pqp::Scene>();
+	}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+	if ("solid" == engine)
+	{
+		return std::make_shared<rl::sg::solid::Scene>();
+	}
+#endif // RL_SG_SOLID
+	throw std::invalid_argument("Unknown engine " + engine);
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 16)
+	{
+		std::cout << "Usage: rlParallelPlannerTest ENGINE SCENEFILE KINEMATICSFILE THREADS RUNS X Y Z A B C START1 ... STARTn GOAL1 ... GOALn" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::size_t threads = boost::lexical_cast<std::size_t>(argv[4]);
+		std::size_t runs = boost::lexical_cast<std::size_t>(argv[5]);
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[11]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[10]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[7]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[8]);
+		
+		std::vector<Worker> workers(threads);
+		
+		for (std::size_t i = 0; i < threads; ++i)
+		{
+			workers[i].scene = createScene(argv[1]);
+			
+			rl::sg::XmlFactory factory;
+			factory.load(argv[2], workers[i].scene.get());
+			
+			workers[i].kinematics = std::shared_ptr<rl::kin::Kinematics>(rl::kin::Kinematics::create(argv[3]));
+			workers[i].kinematics->world() = world;
+			
+			workers[i].model = std::make_shared<rl::plan::SimpleModel>();
+			workers[i].model->kin = workers[i].kinematics.get();
+			workers[i].model->model = workers[i].scene->getModel(0);
+			workers[i].model->scene = workers[i].scene.get();
+			
+			workers[i].sampler = std::make_shared<rl::plan::UniformSampler>();
+			workers[i].sampler->model = workers[i].model.get();
+			
+			workers[i].planner = std::make_shared<rl::plan::RrtConCon>();
+			workers[i].planner->delta = 1 * rl::math::DEG2RAD;
+			workers[i].planner->model = workers[i].model.get();
+			workers[i].planner->sampler = workers[i].sampler.get();
+			
+			for (std::size_t j = 0; j < 2; ++j)
+			{
+				workers[i].nearestNeighbors.push_back(std::make_shared<rl::plan::KdtreeNearestNeighbors>(workers[i].model.get()));
+				workers[i].planner->setNearestNeighbors(workers[i].nearestNeighbors[j].get(), j);
+			}
+		}
+		
+		std::size_t dof = workers[0].kinematics->getDof();
+		
+		rl::math::Vector start(dof);
+		
+		for (std::size_t i = 0; i < dof; ++i)
+		{
+			start(i) = boost::lexical_cast<rl::math::Real>(argv[i + 12]) * rl::math::DEG2RAD;
+		}
+		
+		rl::math::Vector goal(dof);
+		
+		for (std::size_t i = 0; i < dof; ++i)
+		{
+			goal(i) = boost::lexical_cast<rl::math::Real>(argv[dof + i + 12]) * rl::math::DEG2RAD;
+		}
+		
+		for (std::size_t n = 1; n <= threads; n *= 2)
+		{
+			rl::plan::ParallelPlanner planner;
+			planner.duration = std::chrono::seconds(20);
+			planner.goal = &goal;
+			planner.model = workers[0].model.get();
+			planner.start = &start;
+			
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				planner.planners.push_back(workers[i].planner.get());
+			}
+			
+			if (!planner.verify())
+			{
+				std::cerr << "Invalid start or goal configuration." << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			std::chrono::steady_clock::duration total = std::chrono::steady_clock::duration::zero();
+			
+			for (std::size_t k = 0; k < runs; ++k)
+			{
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					workers[i].sampler->seed(k * threads + i);
+				}
+				
+				planner.reset();
+				
+				std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+				bool solved = planner.solve();
+				std::chrono::steady_clock::time_point stopTime = std::chrono::steady_clock::now();
+				
+				if (!solved)
+				{
+					std::cerr << "solve() false with " << n << " threads in run " << k << std::endl;
+					return EXIT_FAILURE;
+				}
+				
+				total += stopTime - startTime;
+			}
+			
+			std::cout << "threads: " << n << " time to first path: " << std::chrono::duration_cast<std::chrono::duration<double>>(total).count() * 1000 / runs << " ms" << std::endl;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,250 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/ParallelVerifier.h>
+#include <rl/plan/RecursiveVerifier.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+struct Worker
+{
+	std::shared_ptr<rl::kin::Kinematics> kinematics;
+	
+	std::shared_ptr<rl::plan::SimpleModel> model;
+	
+	std::shared_ptr<rl::sg::Scene> scene;
+};
+
+std::shared_ptr<rl::sg::Scene>
+createScene(const std::string& engine)
+{
+#ifdef RL_SG_BULLET
+	if ("bullet" == engine)
+	{
+		return std::make_shared<rl::sg::bullet::Scene>();
+	}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+	if ("fcl" == engine)
+	{
+		return std::make_shared<rl::sg::fcl::Scene>();
+	}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+	if ("ode" == engine)
+	{
+		return std::make_shared<rl::sg::ode::Scene>();
+	}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	if ("pqp" == engine)
+	{
+		return std::make_shared<rl::sg::pqp::Scene>();
+	}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+	if ("solid" == engine)
+	{
+		return std::make_shared<rl::sg::solid::Scene>();
+	}
+#endif // RL_SG_SOLID
+	throw std::invalid_argument("Unknown engine " + engine);
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 11)
+	{
+		std::cout << "Usage: rlParallelVerifierTest ENGINE SCENEFILE KINEMATICSFILE THREADS X Y Z A B C" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::size_t threads = boost::lexical_cast<std::size_t>(argv[4]);
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[10]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[7]);
+		
+		std::vector<Worker> workers(threads);
+		
+		for (std::size_t i = 0; i < threads; ++i)
+		{
+			workers[i].scene = createScene(argv[1]);
+			
+			rl::sg::XmlFactory factory;
+			factory.load(argv[2], workers[i].scene.get());
+			
+			workers[i].kinematics = std::shared_ptr<rl::kin::Kinematics>(rl::kin::Kinematics::create(argv[3]));
+			workers[i].kinematics->world() = world;
+			
+			workers[i].model = std::make_shared<rl::plan::SimpleModel>();
+			workers[i].model->kin = workers[i].kinematics.get();
+			workers[i].model->model = workers[i].scene->getModel(0);
+			workers[i].model->scene = workers[i].scene.get();
+		}
+		
+		rl::plan::SimpleModel* model = workers[0].model.get();
+		
+		rl::plan::RecursiveVerifier recursiveVerifier;
+		recursiveVerifier.delta = 1 * rl::math::DEG2RAD;
+		recursiveVerifier.model = model;
+		
+		rl::plan::ParallelVerifier parallelVerifier;
+		parallelVerifier.delta = recursiveVerifier.delta;
+		parallelVerifier.model = model;
+		
+		for (std::size_t i = 0; i < workers.size(); ++i)
+		{
+			parallelVerifier.models.push_back(workers[i].model.get());
+		}
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(0, 1);
+		
+		std::size_t colliding = 0;
+		std::size_t free = 0;
+		
+		// repeated batches reuse worker threads, last batches restart them with fewer models
+		
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			if (15 == i && parallelVerifier.models.size() > 2)
+			{
+				parallelVerifier.models.resize(2);
+			}
+			
+			std::vector<rl::math::Vector> u(1 + i % 7, rl::math::Vector(model->getDofPosition()));
+			std::vector<rl::math::Vector> v(u.size(), rl::math::Vector(model->getDofPosition()));
+			std::vector<rl::plan::Verifier::Edge> edges(u.size());
+			
+			for (std::size_t j = 0; j < edges.size(); ++j)
+			{
+				rl::math::Vector rand(model->getDofPosition());
+				
+				for (std::ptrdiff_t k = 0; k < rand.size(); ++k)
+				{
+					rand(k) = randomDistribution(randomEngine);
+				}
+				
+				u[j] = model->generatePositionUniform(rand);
+				
+				for (std::ptrdiff_t k = 0; k < v[j].size(); ++k)
+				{
+					v[j](k) = u[j](k) + randomDistribution(randomEngine) - static_cast<rl::math::Real>(0.5);
+				}
+				
+				edges[j].d = model->distance(u[j], v[j]);
+				edges[j].u = &u[j];
+				edges[j].v = &v[j];
+			}
+			
+			std::vector<bool> results = parallelVerifier.isColliding(edges);
+			
+			if (results.size() != edges.size())
+			{
+				std::cerr << "Parallel verifier returned " << results.size() << " results for " << edges.size() << " edges." << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			for (std::size_t j = 0; j < edges.size(); ++j)
+			{
+				bool expected = recursiveVerifier.isColliding(u[j], v[j], edges[j].d);
+				
+				if (results[j] != expected || parallelVerifier.isColliding(u[j], v[j], edges[j].d) != expected)
+				{
+					std::cerr << "Parallel verifier differs from recursive verifier in edge " << j << " of batch " << i << " between " << u[j].transpose() << " and " << v[j].transpose() << std::endl;
+					return EXIT_FAILURE;
+				}
+				
+				if (expected)
+				{
+					++colliding;
+				}
+				else
+				{
+					++free;
+				}
+			}
+		}
+		
+		std::cout << "Colliding edges: " << colliding << ", free edges: " << free << std::endl;
+		
+		if (0 == colliding || 0 == free)
+		{
+			std::cerr << "Found no colliding or no free edges." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
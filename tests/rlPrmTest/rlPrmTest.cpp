@@ -27,14 +27,17 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <rl/kin/Kinematics.h>
 #include <rl/math/Unit.h>
+#include <rl/plan/Exception.h>
 #include <rl/plan/KdtreeNearestNeighbors.h>
 #include <rl/plan/Prm.h>
 #include <rl/plan/RecursiveVerifier.h>
 #include <rl/plan/SimpleModel.h>
 #include <rl/plan/SimpleOptimizer.h>
+#include <rl/plan/Statistics.h>
 #include <rl/plan/UniformSampler.h>
 #include <rl/sg/Model.h>
 #include <rl/sg/XmlFactory.h>
@@ -55,6 +58,23 @@
 #include <rl/sg/solid/Scene.h>
 #endif // RL_SG_SOLID
 
+struct TemporaryDirectory
+{
+	TemporaryDirectory() :
+		path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("rlPrmTest-%%%%-%%%%-%%%%-%%%%"))
+	{
+		boost::filesystem::create_directory(this->path);
+	}
+	
+	~TemporaryDirectory()
+	{
+		boost::system::error_code error;
+		boost::filesystem::remove_all(this->path, error);
+	}
+	
+	boost::filesystem::path path;
+};
+
 int
 main(int argc, char** argv)
 {
@@ -132,12 +152,16 @@ main(int argc, char** argv)
 		rl::plan::Prm planner;
 		rl::plan::UniformSampler sampler;
 		rl::plan::RecursiveVerifier verifier;
+		rl::plan::Statistics statistics;
 		
 		sampler.seed(0);
 		
+		model.statistics = &statistics;
+		
 		planner.model = &model;
 		planner.setNearestNeighbors(&nearestNeighbors);
 		planner.sampler = &sampler;
+		planner.statistics = &statistics;
 		planner.verifier = &verifier;
 		
 		sampler.model = &model;
@@ -179,6 +203,69 @@ main(int argc, char** argv)
 		
 		std::cout << "NumVertices: " << planner.getNumVertices() << "  NumEdges: " << planner.getNumEdges() << std::endl;
 		
+		std::cout << "Statistics: ";
+		statistics.write(std::cout);
+		std::cout << std::endl;
+		
+		if (statistics.getCount(rl::plan::Statistics::PHASE_COLLISION) != model.getTotalQueries() ||
+			statistics.getCount(rl::plan::Statistics::PHASE_GRAPH) != planner.getNumVertices() + planner.getNumEdges())
+		{
+			std::cerr << "Statistics do not match number of queries, vertices, and edges." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		TemporaryDirectory directory;
+		std::string filename = (directory.path / "rlPrmTest.prm").string();
+		
+		planner.save(filename, true);
+		
+		rl::plan::KdtreeNearestNeighbors nearestNeighbors2(&model);
+		rl::plan::Prm planner2;
+		planner2.model = &model;
+		planner2.setNearestNeighbors(&nearestNeighbors2);
+		planner2.sampler = &sampler;
+		planner2.verifier = &verifier;
+		planner2.load(filename);
+		
+		if (planner2.getNumVertices() != planner.getNumVertices() || planner2.getNumEdges() != planner.getNumEdges())
+		{
+			std::cerr << "Loaded roadmap does not match saved roadmap." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		planner2.construct(5);
+		planner2.save(filename, true);
+		
+		rl::plan::KdtreeNearestNeighbors nearestNeighbors3(&model);
+		rl::plan::Prm planner3;
+		planner3.model = &model;
+		planner3.setNearestNeighbors(&nearestNeighbors3);
+		planner3.load(filename);
+		
+		rl::plan::KdtreeNearestNeighbors nearestNeighbors4(&model);
+		rl::plan::Prm planner4;
+		planner4.model = &model;
+		planner4.setNearestNeighbors(&nearestNeighbors4);
+		planner4.sampler = &sampler;
+		planner4.verifier = &verifier;
+		planner4.construct(5);
+		
+		try
+		{
+			planner4.save(filename, true);
+			std::cerr << "Appending roadmap not stored in file did not throw." << std::endl;
+			return EXIT_FAILURE;
+		}
+		catch (const rl::plan::Exception&)
+		{
+		}
+		
+		if (planner3.getNumVertices() != planner2.getNumVertices() || planner3.getNumEdges() != planner2.getNumEdges())
+		{
+			std::cerr << "Loaded roadmap does not match appended roadmap." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
 		if (solved)
 		{
 			if (boost::lexical_cast<std::size_t>(argv[4]) >= planner.getNumVertices() &&
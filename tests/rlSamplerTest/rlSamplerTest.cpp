@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/HaltonSampler.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+struct Worker
+{
+	std::shared_ptr<rl::kin::Kinematics> kinematics;
+	
+	std::shared_ptr<rl::plan::SimpleModel> model;
+	
+	std::shared_ptr<rl::sg::Scene> scene;
+};
+
+std::shared_ptr<rl::sg::Scene>
+createScene(const std::string& engine)
+{
+#ifdef RL_SG_BULLET
+	if ("bullet" == engine)
+	{
+		return std::make_shared<rl::sg::bullet::Scene>();
+	}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+	if ("fcl" == engine)
+	{
+		return std::make_shared<rl::sg::fcl::Scene>();
+	}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+	if ("ode" == engine)
+	{
+		return std::make_shared<rl::sg::ode::Scene>();
+	}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	if ("pqp" == engine)
+	{
+		return std::make_shared<rl::sg::pqp::Scene>();
+	}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+	if ("solid" == engine)
+	{
+		return std::make_shared<rl::sg::solid::Scene>();
+	}
+#endif // RL_SG_SOLID
+	throw std::invalid_argument("Unknown engine " + engine);
+}
+
+/**
+ * Compare batches of a sampler with models against single samples of a
+ * sampler with one model, both started with the same seed.
+ */
+template<typename T>
+bool
+test(const std::string& name, std::vector<Worker>& workers)
+{
+	T sampler;
+	sampler.model = workers[0].model.get();
+	sampler.seed(0);
+	
+	for (std::size_t i = 0; i < workers.size(); ++i)
+	{
+		sampler.models.push_back(workers[i].model.get());
+	}
+	
+	T reference;
+	reference.model = workers[0].model.get();
+	reference.seed(0);
+	
+	// batch sizes smaller and larger than the number of models
+	
+	std::size_t sizes[] = {1, 7, 2, 13, 3, 30};
+	
+	for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+	{
+		rl::math::Matrix q = rl::math::Matrix::Constant(
+			workers[0].model->getDofPosition(),
+			sizes[i],
+			std::numeric_limits<rl::math::Real>::quiet_NaN()
+		);
+		
+		sampler.generateCollisionFree(q);
+		
+		for (std::ptrdiff_t j = 0; j < q.cols(); ++j)
+		{
+			rl::math::Vector expected = reference.generateCollisionFree();
+			
+			if (workers[0].model->isColliding(q.col(j)))
+			{
+				std::cerr << name << ": colliding configuration in column " << j << " of batch " << i << std::endl;
+				return false;
+			}
+			
+			if (!q.col(j).isApprox(expected))
+			{
+				std::cerr << name << ": configuration in column " << j << " of batch " << i << " differs from sequence" << std::endl;
+				std::cerr << "q: " << q.col(j).transpose() << std::endl;
+				std::cerr << "expected: " << expected.transpose() << std::endl;
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 11)
+	{
+		std::cout << "Usage: rlSamplerTest ENGINE SCENEFILE KINEMATICSFILE THREADS X Y Z A B C" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::size_t threads = boost::lexical_cast<std::size_t>(argv[4]);
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[10]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[7]);
+		
+		std::vector<Worker> workers(threads);
+		
+		for (std::size_t i = 0; i < threads; ++i)
+		{
+			workers[i].scene = createScene(argv[1]);
+			
+			rl::sg::XmlFactory factory;
+			factory.load(argv[2], workers[i].scene.get());
+			
+			workers[i].kinematics = std::shared_ptr<rl::kin::Kinematics>(rl::kin::Kinematics::create(argv[3]));
+			workers[i].kinematics->world() = world;
+			
+			workers[i].model = std::make_shared<rl::plan::SimpleModel>();
+			workers[i].model->kin = workers[i].kinematics.get();
+			workers[i].model->model = workers[i].scene->getModel(0);
+			workers[i].model->scene = workers[i].scene.get();
+		}
+		
+		if (!test<rl::plan::HaltonSampler>("HaltonSampler", workers))
+		{
+			return EXIT_FAILURE;
+		}
+		
+		if (!test<rl::plan::UniformSampler>("UniformSampler", workers))
+		{
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/KdtreeNearestNeighbors.h>
+#include <rl/plan/LazyPrm.h>
+#include <rl/plan/ParallelVerifier.h>
+#include <rl/plan/RecursiveVerifier.h>
+#include <rl/plan/SequentialVerifier.h>
+#include <rl/plan/ShortcutOptimizer.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+struct Worker
+{
+	std::shared_ptr<rl::kin::Kinematics> kinematics;
+	
+	std::shared_ptr<rl::plan::SimpleModel> model;
+	
+	std::shared_ptr<rl::sg::Scene> scene;
+};
+
+std::shared_ptr<rl::sg::Scene>
+createScene(const std::string& engine)
+{
+#ifdef RL_SG_BULLET
+	if ("bullet" == engine)
+	{
+		return std::make_shared<rl::sg::bullet::Scene>();
+	}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+	if ("fcl" == engine)
+	{
+		return std::make_shared<rl::sg::fcl::Scene>();
+	}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+	if ("ode" == engine)
+	{
+		return std::make_shared<rl::sg::ode::Scene>();
+	}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+	if ("pqp" == engine)
+	{
+		return std::make_shared<rl::sg::pqp::Scene>();
+	}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+	if ("solid" == engine)
+	{
+		return std::make_shared<rl::sg::solid::Scene>();
+	}
+#endif // RL_SG_SOLID
+	throw std::invalid_argument("Unknown engine " + engine);
+}
+
+rl::math::Real
+length(const rl::plan::SimpleModel& model, const rl::plan::VectorList& path)
+{
+	rl::math::Real length = 0;
+	
+	rl::plan::VectorList::const_iterator i = path.begin();
+	rl::plan::VectorList::const_iterator j = ++path.begin();
+	
+	for (; i != path.end() && j != path.end(); ++i, ++j)
+	{
+		length += model.distance(*i, *j);
+	}
+	
+	return length;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 12)
+	{
+		std::cout << "Usage: rlShortcutOptimizerTest ENGINE SCENEFILE KINEMATICSFILE X Y Z A B C START1 ... STARTn GOAL1 ... GOALn" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene = createScene(argv[1]);
+		
+		rl::sg::XmlFactory factory;
+		factory.load(argv[2], scene.get());
+		
+		std::shared_ptr<rl::kin::Kinematics> kinematics(rl::kin::Kinematics::create(argv[3]));
+		
+		if (argc < static_cast<int>(2 * kinematics->getDof()) + 10)
+		{
+			std::cerr << "Expected " << kinematics->getDof() << " values each for START and GOAL." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[7]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[4]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		
+		kinematics->world() = world;
+		
+		rl::plan::SimpleModel model;
+		model.kin = kinematics.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		rl::plan::KdtreeNearestNeighbors nearestNeighbors(&model);
+		rl::plan::LazyPrm planner;
+		rl::plan::UniformSampler sampler;
+		rl::plan::RecursiveVerifier verifier;
+		
+		sampler.seed(0);
+		
+		planner.model = &model;
+		planner.setNearestNeighbors(&nearestNeighbors);
+		planner.sampler = &sampler;
+		planner.verifier = &verifier;
+		
+		sampler.model = &model;
+		
+		verifier.delta = 1 * rl::math::DEG2RAD;
+		verifier.model = &model;
+		
+		rl::math::Vector start(kinematics->getDof());
+		
+		for (std::size_t i = 0; i < kinematics->getDof(); ++i)
+		{
+			start(i) = boost::lexical_cast<rl::math::Real>(argv[i + 10]) * rl::math::DEG2RAD;
+		}
+		
+		planner.start = &start;
+		
+		rl::math::Vector goal(kinematics->getDof());
+		
+		for (std::size_t i = 0; i < kinematics->getDof(); ++i)
+		{
+			goal(i) = boost::lexical_cast<rl::math::Real>(argv[kinematics->getDof() + i + 10]) * rl::math::DEG2RAD;
+		}
+		
+		planner.goal = &goal;
+		
+		planner.duration = std::chrono::seconds(20);
+		
+		std::cout << "construct() ... " << std::endl;;
+		std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		planner.construct(15);
+		std::chrono::steady_clock::time_point stopTime = std::chrono::steady_clock::now();
+		std::cout << "construct() " << std::chrono::duration_cast<std::chrono::duration<double>>(stopTime - startTime).count() * 1000 << " ms" << std::endl;
+		
+		std::cout << "solve() ... " << std::endl;;
+		startTime = std::chrono::steady_clock::now();
+		bool solved = planner.solve();
+		stopTime = std::chrono::steady_clock::now();
+		std::cout << "solve() " << (solved ? "true" : "false") << " " << std::chrono::duration_cast<std::chrono::duration<double>>(stopTime - startTime).count() * 1000 << " ms" << std::endl;
+		
+		std::cout << "NumVertices: " << planner.getNumVertices() << "  NumEdges: " << planner.getNumEdges() << std::endl;
+		
+		if (!solved)
+		{
+			std::cerr << "Planner did not find a solution." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::plan::VectorList path = planner.getPath();
+		rl::plan::VectorList parallelPath = path;
+		rl::math::Real initial = length(model, path);
+		
+		rl::plan::ShortcutOptimizer optimizer;
+		optimizer.model = &model;
+		optimizer.seed(0);
+		optimizer.verifier = &verifier;
+		
+		std::cout << "process() ... " << std::endl;;
+		startTime = std::chrono::steady_clock::now();
+		optimizer.process(path);
+		stopTime = std::chrono::steady_clock::now();
+		std::cout << "process() " << std::chrono::duration_cast<std::chrono::duration<double>>(stopTime - startTime).count() * 1000 << " ms" << std::endl;
+		
+		rl::math::Real optimized = length(model, path);
+		
+		std::cout << "Length: " << initial << "  Optimized: " << optimized << std::endl;
+		
+		if (optimized > initial)
+		{
+			std::cerr << "Optimized path is longer than initial path." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (path.size() < 2 || !path.front().isApprox(start) || !path.back().isApprox(goal))
+		{
+			std::cerr << "Optimized path does not connect start and goal." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// parallel verification with one model per thread
+		
+		std::vector<Worker> workers(4);
+		
+		for (std::size_t i = 0; i < workers.size(); ++i)
+		{
+			workers[i].scene = createScene(argv[1]);
+			
+			rl::sg::XmlFactory factory;
+			factory.load(argv[2], workers[i].scene.get());
+			
+			workers[i].kinematics = std::shared_ptr<rl::kin::Kinematics>(rl::kin::Kinematics::create(argv[3]));
+			workers[i].kinematics->world() = world;
+			
+			workers[i].model = std::make_shared<rl::plan::SimpleModel>();
+			workers[i].model->kin = workers[i].kinematics.get();
+			workers[i].model->model = workers[i].scene->getModel(0);
+			workers[i].model->scene = workers[i].scene.get();
+		}
+		
+		rl::plan::ParallelVerifier parallelVerifier;
+		parallelVerifier.delta = verifier.delta;
+		parallelVerifier.model = workers[0].model.get();
+		
+		for (std::size_t i = 0; i < workers.size(); ++i)
+		{
+			parallelVerifier.models.push_back(workers[i].model.get());
+		}
+		
+		rl::plan::ShortcutOptimizer parallelOptimizer;
+		parallelOptimizer.model = workers[0].model.get();
+		parallelOptimizer.seed(0);
+		parallelOptimizer.verifier = &parallelVerifier;
+		
+		std::cout << "process() with " << workers.size() << " threads ... " << std::endl;
+		startTime = std::chrono::steady_clock::now();
+		parallelOptimizer.process(parallelPath);
+		stopTime = std::chrono::steady_clock::now();
+		std::cout << "process() with " << workers.size() << " threads " << std::chrono::duration_cast<std::chrono::duration<double>>(stopTime - startTime).count() * 1000 << " ms" << std::endl;
+		
+		if (parallelPath.size() != path.size() || !std::equal(parallelPath.begin(), parallelPath.end(), path.begin(), [](const rl::math::Vector& a, const rl::math::Vector& b) { return a.isApprox(b); }))
+		{
+			std::cerr << "Optimized path with parallel verifier differs from optimized path with recursive verifier." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::plan::SequentialVerifier sequentialVerifier;
+		sequentialVerifier.delta = verifier.delta;
+		sequentialVerifier.model = &model;
+		
+		rl::plan::VectorList::iterator i = path.begin();
+		rl::plan::VectorList::iterator j = ++path.begin();
+		
+		for (; i != path.end() && j != path.end(); ++i, ++j)
+		{
+			if (model.isColliding(*i) || sequentialVerifier.isColliding(*i, *j, model.distance(*i, *j)))
+			{
+				std::cerr << "Optimized path contains colliding edges." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,340 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/kin/Kinematics.h>
+#include <rl/math/Unit.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/sg/Body.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+std::vector<bool>
+isColliding(rl::plan::SimpleModel& model, const std::vector<rl::math::Vector>& q)
+{
+	std::vector<bool> colliding(q.size());
+	
+	for (std::size_t i = 0; i < q.size(); ++i)
+	{
+		colliding[i] = model.isColliding(q[i]);
+	}
+	
+	return colliding;
+}
+
+std::vector<bool>
+isCollidingReference(rl::kin::Kinematics* kinematics, rl::sg::Scene* scene, const std::vector<rl::math::Vector>& q)
+{
+	rl::plan::SimpleModel model;
+	model.kin = kinematics;
+	model.model = scene->getModel(0);
+	model.scene = scene;
+	model.setLastPairFirst(false);
+	
+	return isColliding(model, q);
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 10)
+	{
+		std::cout << "Usage: rlSimpleModelTest ENGINE SCENEFILE KINEMATICSFILE X Y Z A B C" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+		if ("ode" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::ode::Scene>();
+		}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory;
+		factory.load(argv[2], scene.get());
+		
+		std::shared_ptr<rl::kin::Kinematics> kinematics(rl::kin::Kinematics::create(argv[3]));
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitZ()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitY()
+		) * ::rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[7]) * ::rl::math::DEG2RAD,
+			::rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[4]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		
+		kinematics->world() = world;
+		
+		rl::plan::SimpleModel model;
+		model.kin = kinematics.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randomDistribution(0, 1);
+		
+		std::vector<rl::math::Vector> q(1000);
+		
+		for (std::size_t i = 0; i < q.size(); ++i)
+		{
+			rl::math::Vector rand(model.getDofPosition());
+			
+			for (std::ptrdiff_t j = 0; j < rand.size(); ++j)
+			{
+				rand(j) = randomDistribution(randomEngine);
+			}
+			
+			q[i] = model.generatePositionUniform(rand);
+		}
+		
+		// test pair of last collision first
+		
+		std::vector<bool> expected = isCollidingReference(kinematics.get(), scene.get(), q);
+		
+		if (isColliding(model, q) != expected)
+		{
+			std::cerr << "Results with last pair first differ from results in pair order." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		std::size_t colliding = std::count(expected.begin(), expected.end(), true);
+		
+		std::cout << "Colliding configurations: " << colliding << " of " << q.size() << std::endl;
+		
+		// remove and add obstacles
+		
+		std::vector<rl::sg::Body*> obstacles;
+		
+		for (std::size_t i = 1; i < scene->getNumModels(); ++i)
+		{
+			while (scene->getModel(i)->getNumBodies() > 0)
+			{
+				obstacles.push_back(scene->getModel(i)->getBody(0));
+				scene->getModel(i)->remove(obstacles.back());
+			}
+		}
+		
+		std::vector<bool> removed = isCollidingReference(kinematics.get(), scene.get(), q);
+		
+		if (removed == expected)
+		{
+			std::cerr << "Scene requires configurations colliding with obstacles." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (isColliding(model, q) != removed)
+		{
+			std::cerr << "Results after removing obstacles differ from new model." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::size_t i = 0; i < obstacles.size(); ++i)
+		{
+			obstacles[i]->getModel()->add(obstacles[i]);
+		}
+		
+		if (isColliding(model, q) != expected)
+		{
+			std::cerr << "Results after adding obstacles differ from initial results." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// disable collisions with environment
+		
+		std::vector<bool> bodies(kinematics->getBodies());
+		
+		for (std::size_t i = 0; i < kinematics->getBodies(); ++i)
+		{
+			bodies[i] = kinematics->isColliding(i);
+			kinematics->setColliding(i, false);
+		}
+		
+		model.invalidatePairs();
+		
+		if (isColliding(model, q) != isCollidingReference(kinematics.get(), scene.get(), q))
+		{
+			std::cerr << "Results after disabling collisions differ from new model." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::size_t i = 0; i < kinematics->getBodies(); ++i)
+		{
+			kinematics->setColliding(i, bodies[i]);
+		}
+		
+		model.invalidatePairs();
+		
+		if (isColliding(model, q) != expected)
+		{
+			std::cerr << "Results after enabling collisions differ from initial results." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// cache hits
+		
+		model.reset();
+		model.setCacheSize(q.size());
+		
+		if (isColliding(model, q) != expected || model.getCacheMisses() != q.size())
+		{
+			std::cerr << "Results with empty cache differ from initial results." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::size_t i = 0; i < q.size(); ++i)
+		{
+			if (model.isColliding(q[i]) != expected[i] || model.isColliding() != expected[i])
+			{
+				std::cerr << "Cached result or frames of configuration " << i << " differ from initial results." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		if (model.getCacheHits() != q.size())
+		{
+			std::cerr << "Cache hits " << model.getCacheHits() << " differ from " << q.size() << " queries." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// cache eviction
+		
+		model.reset();
+		model.setCacheSize(10);
+		
+		for (std::size_t i = 0; i < 11; ++i)
+		{
+			model.isColliding(q[i]);
+		}
+		
+		model.isColliding(q[1]);
+		model.isColliding(q[0]);
+		
+		if (model.getCacheHits() != 1 || model.getCacheMisses() != 12)
+		{
+			std::cerr << "Cache hits " << model.getCacheHits() << " and misses " << model.getCacheMisses() << " differ from eviction in insertion order." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// cache invalidation after moving obstacles
+		
+		model.reset();
+		model.setCacheSize(q.size());
+		isColliding(model, q);
+		
+		std::vector<rl::math::Transform, Eigen::aligned_allocator<rl::math::Transform>> frames(obstacles.size());
+		
+		for (std::size_t i = 0; i < obstacles.size(); ++i)
+		{
+			obstacles[i]->getFrame(frames[i]);
+			rl::math::Transform frame = frames[i];
+			frame.translation().z() += 1000;
+			obstacles[i]->setFrame(frame);
+		}
+		
+		if (isColliding(model, q) != removed)
+		{
+			std::cerr << "Cached results after moving obstacles differ from results without obstacles." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::size_t i = 0; i < obstacles.size(); ++i)
+		{
+			obstacles[i]->setFrame(frames[i]);
+		}
+		
+		if (isColliding(model, q) != expected)
+		{
+			std::cerr << "Cached results after restoring obstacles differ from initial results." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
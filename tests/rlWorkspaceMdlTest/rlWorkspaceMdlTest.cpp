@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2020, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/Workspace.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 4)
+	{
+		std::cout << "Usage: rlWorkspaceMdlTest MODELFILE LOOP THREADS" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		srand(std::random_device()());
+		
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		std::size_t loop = boost::lexical_cast<std::size_t>(argv[2]);
+		std::size_t threads = boost::lexical_cast<std::size_t>(argv[3]);
+		
+		std::vector<rl::math::Vector> q(loop, rl::math::Vector(dynamic->getDofPosition()));
+		std::vector<rl::math::Vector> qd(loop, rl::math::Vector(dynamic->getDof()));
+		std::vector<rl::math::Vector> qdd(loop, rl::math::Vector(dynamic->getDof()));
+		std::vector<rl::math::Vector> G(loop);
+		std::vector<rl::math::Matrix> J(loop, rl::math::Matrix(6 * dynamic->getOperationalDof(), dynamic->getDof()));
+		std::vector<rl::math::Matrix> M(loop);
+		std::vector<rl::math::Vector> tau(loop);
+		std::vector<rl::math::Matrix> x(loop, rl::math::Matrix(4, 4 * dynamic->getOperationalDof()));
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			q[i].setRandom();
+			qd[i].setRandom();
+			qdd[i].setRandom();
+			
+			dynamic->setPosition(q[i]);
+			dynamic->forwardPosition();
+			
+			for (std::size_t j = 0; j < dynamic->getOperationalDof(); ++j)
+			{
+				x[i].block(0, 4 * j, 4, 4) = dynamic->getOperationalPosition(j).matrix();
+			}
+			
+			dynamic->calculateJacobian(J[i]);
+			dynamic->calculateMassMatrix(M[i]);
+			dynamic->calculateGravity(G[i]);
+			
+			dynamic->setPosition(q[i]);
+			dynamic->setVelocity(qd[i]);
+			dynamic->setAcceleration(qdd[i]);
+			dynamic->inverseDynamics();
+			tau[i] = dynamic->getTorque();
+		}
+		
+		std::vector<std::size_t> errors(threads, 0);
+		std::vector<std::thread> workers;
+		
+		for (std::size_t k = 0; k < threads; ++k)
+		{
+			workers.push_back(std::thread([&, k]() {
+				rl::mdl::Workspace workspace(dynamic.get());
+				rl::math::Vector g;
+				rl::math::Matrix j(6 * dynamic->getOperationalDof(), dynamic->getDof());
+				rl::math::Matrix m;
+				
+				for (std::size_t i = k; i < loop * threads; i += threads)
+				{
+					std::size_t n = i % loop;
+					
+					workspace.q = q[n];
+					workspace.qd = qd[n];
+					workspace.qdd = qdd[n];
+					dynamic->forwardPosition(workspace);
+					
+					for (std::size_t l = 0; l < dynamic->getOperationalDof(); ++l)
+					{
+						if (!workspace.operational[l].matrix().isApprox(x[n].block(0, 4 * l, 4, 4)))
+						{
+							++errors[k];
+						}
+					}
+					
+					dynamic->calculateJacobian(workspace, j);
+					
+					if (!j.isApprox(J[n]))
+					{
+						++errors[k];
+					}
+					
+					dynamic->calculateMassMatrix(workspace, m);
+					
+					if (!m.isApprox(M[n]))
+					{
+						++errors[k];
+					}
+					
+					dynamic->calculateGravity(workspace, g);
+					
+					if (!g.isApprox(G[n]))
+					{
+						++errors[k];
+					}
+					
+					dynamic->inverseDynamics(workspace);
+					
+					if (!workspace.tau.isApprox(tau[n]))
+					{
+						++errors[k];
+					}
+					
+					workspace.qdd.setZero();
+					dynamic->forwardDynamics(workspace);
+					
+					if (!workspace.qdd.isApprox(qdd[n]))
+					{
+						++errors[k];
+					}
+				}
+			}));
+		}
+		
+		for (std::size_t k = 0; k < threads; ++k)
+		{
+			workers[k].join();
+		}
+		
+		for (std::size_t k = 0; k < threads; ++k)
+		{
+			if (errors[k] > 0)
+			{
+				std::cerr << "thread " << k << ": " << errors[k] << " mismatches" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}